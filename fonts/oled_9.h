@@ -5,23 +5,26 @@
  * Font Height: 9
  * Character Set: Custom (69 characters)
  * Character Spacing: 1 pixels
- * Data Size: 962 bytes
+ * Data Size: 866 bytes
  * Source Font: Template
  * Bytes per Column: 2
  *
  * Font Data Format:
- * - First 5 bytes: max width, height, char count MSB, char count LSB, spacing
+ * - First 5 bytes: max width, height, flags | char count MSB, char count LSB, spacing
+ *   - flags 0x80: glyphs are cropped to their ink bounding box
  * - Character Table: N bytes listing the codes of included characters
  * - Jump Table: 4 bytes per character
  *   - byte 0-1: MSB & LSB of offset in data array
  *   - byte 2: Size in bytes of this character's bitmap
  *   - byte 3: Width of character in pixels
  * - Font Data: Bitmap data for all characters
+ *   - each glyph starts with 3 bytes: x offset, y offset, bytes per column
+ *     followed by the inked columns only
  *
  * To render character 'X':
  * 1. Get font info from header:
  *    - Get max width, height from bytes 0-1
- *    - Get character count from (byte 2 << 8) | byte 3
+ *    - Get character count from ((byte 2 & 0x1F) << 8) | byte 3
  *    - Get recommended spacing from byte 4
  * 2. Search for character code of 'X' in the character table
  *    (bytes 5 to 5+N-1)
@@ -31,11 +34,11 @@
  *    - offset = (jump_table[0] << 8) | jump_table[1]
  *    - size = jump_table[2]
  *    - width = jump_table[3]
- * 5. Bytes per column: 2
- * 6. Render bitmap columns from the data section
+ * 5. Read the glyph header, bytes per column is given per glyph
+ * 6. Render bitmap columns from the data section at (x + x offset, y + y offset)
  * 7. Advance cursor position by: character_width + font_spacing
  *
- * This file was automatically generated by font_template_generator on 2025-03-05
+ * This file was automatically generated by font_template_generator on 2026-10-18
  * Created by Luc LEBOSSE
  *
  * This font data is licensed under the GNU LGPL v3 License.
@@ -47,7 +50,7 @@
 const char oled_9[] PROGMEM = {
 	0x07, // Width: 7 (maximum)
 	0x09, // Height: 9
-	0x00, // Number of Chars MSB
+	0x80, // Number of Chars MSB (cropped glyphs)
 	0x45, // Number of Chars LSB: 69
 	0x01, // Character Spacing: 1 pixels
 
@@ -123,139 +126,129 @@ const char oled_9[] PROGMEM = {
 	0x7E, // 68: '~'
 
 	// Jump Table: Format is [MSB, LSB, size, width]
-	0x00, 0x00, 0x08, 0x04,  // 32:0 ' ' width:4px
-	0x00, 0x08, 0x02, 0x01,  // 33:8 '!' width:1px
-	0x00, 0x0A, 0x08, 0x04,  // 34:10 '"' width:4px
-	0x00, 0x12, 0x0A, 0x05,  // 35:18 '#' width:5px
-	0x00, 0x1C, 0x0A, 0x05,  // 36:28 '$' width:5px
-	0x00, 0x26, 0x0E, 0x07,  // 37:38 '%' width:7px
-	0x00, 0x34, 0x0A, 0x05,  // 38:52 '&' width:5px
-	0x00, 0x3E, 0x02, 0x01,  // 39:62 ''' width:1px
-	0x00, 0x40, 0x06, 0x03,  // 40:64 '(' width:3px
-	0x00, 0x46, 0x06, 0x03,  // 41:70 ')' width:3px
-	0x00, 0x4C, 0x0A, 0x05,  // 42:76 '*' width:5px
-	0x00, 0x56, 0x0A, 0x05,  // 43:86 '+' width:5px
-	0x00, 0x60, 0x04, 0x02,  // 44:96 ',' width:2px
-	0x00, 0x64, 0x08, 0x04,  // 45:100 '-' width:4px
-	0x00, 0x6C, 0x04, 0x02,  // 46:108 '.' width:2px
-	0x00, 0x70, 0x0A, 0x05,  // 47:112 '/' width:5px
-	0x00, 0x7A, 0x0A, 0x05,  // 48:122 '0' width:5px
-	0x00, 0x84, 0x06, 0x03,  // 49:132 '1' width:3px
-	0x00, 0x8A, 0x0A, 0x05,  // 50:138 '2' width:5px
-	0x00, 0x94, 0x0A, 0x05,  // 51:148 '3' width:5px
-	0x00, 0x9E, 0x0A, 0x05,  // 52:158 '4' width:5px
-	0x00, 0xA8, 0x0A, 0x05,  // 53:168 '5' width:5px
-	0x00, 0xB2, 0x0A, 0x05,  // 54:178 '6' width:5px
-	0x00, 0xBC, 0x0A, 0x05,  // 55:188 '7' width:5px
-	0x00, 0xC6, 0x0A, 0x05,  // 56:198 '8' width:5px
-	0x00, 0xD0, 0x0A, 0x05,  // 57:208 '9' width:5px
-	0x00, 0xDA, 0x04, 0x02,  // 58:218 ':' width:2px
-	0x00, 0xDE, 0x06, 0x03,  // 59:222 ';' width:3px
-	0x00, 0xE4, 0x0A, 0x05,  // 60:228 '<' width:5px
-	0x00, 0xEE, 0x08, 0x04,  // 61:238 '=' width:4px
-	0x00, 0xF6, 0x0A, 0x05,  // 62:246 '>' width:5px
-	0x01, 0x00, 0x0A, 0x05,  // 63:256 '?' width:5px
-	0x01, 0x0A, 0x0A, 0x05,  // 64:266 '@' width:5px
-	0x01, 0x14, 0x0A, 0x05,  // 65:276 'A' width:5px
-	0x01, 0x1E, 0x0A, 0x05,  // 66:286 'B' width:5px
-	0x01, 0x28, 0x0A, 0x05,  // 67:296 'C' width:5px
-	0x01, 0x32, 0x0A, 0x05,  // 68:306 'D' width:5px
-	0x01, 0x3C, 0x0A, 0x05,  // 69:316 'E' width:5px
-	0x01, 0x46, 0x0A, 0x05,  // 70:326 'F' width:5px
-	0x01, 0x50, 0x0A, 0x05,  // 71:336 'G' width:5px
-	0x01, 0x5A, 0x0A, 0x05,  // 72:346 'H' width:5px
-	0x01, 0x64, 0x06, 0x03,  // 73:356 'I' width:3px
-	0x01, 0x6A, 0x0A, 0x05,  // 74:362 'J' width:5px
-	0x01, 0x74, 0x0A, 0x05,  // 75:372 'K' width:5px
-	0x01, 0x7E, 0x0A, 0x05,  // 76:382 'L' width:5px
-	0x01, 0x88, 0x0E, 0x07,  // 77:392 'M' width:7px
-	0x01, 0x96, 0x0A, 0x05,  // 78:406 'N' width:5px
-	0x01, 0xA0, 0x0A, 0x05,  // 79:416 'O' width:5px
-	0x01, 0xAA, 0x0A, 0x05,  // 80:426 'P' width:5px
-	0x01, 0xB4, 0x0A, 0x05,  // 81:436 'Q' width:5px
-	0x01, 0xBE, 0x0A, 0x05,  // 82:446 'R' width:5px
-	0x01, 0xC8, 0x0A, 0x05,  // 83:456 'S' width:5px
-	0x01, 0xD2, 0x0A, 0x05,  // 84:466 'T' width:5px
-	0x01, 0xDC, 0x0A, 0x05,  // 85:476 'U' width:5px
-	0x01, 0xE6, 0x0A, 0x05,  // 86:486 'V' width:5px
-	0x01, 0xF0, 0x0E, 0x07,  // 87:496 'W' width:7px
-	0x01, 0xFE, 0x0A, 0x05,  // 88:510 'X' width:5px
-	0x02, 0x08, 0x0A, 0x05,  // 89:520 'Y' width:5px
-	0x02, 0x12, 0x0A, 0x05,  // 90:530 'Z' width:5px
-	0x02, 0x1C, 0x08, 0x04,  // 91:540 '[' width:4px
-	0x02, 0x24, 0x0A, 0x05,  // 92:548 'backslash' width:5px
-	0x02, 0x2E, 0x08, 0x04,  // 93:558 ']' width:4px
-	0x02, 0x36, 0x0A, 0x05,  // 94:566 '^' width:5px
-	0x02, 0x40, 0x0A, 0x05,  // 95:576 '_' width:5px
-	0x02, 0x4A, 0x04, 0x02,  // 96:586 '`' width:2px
-	0x02, 0x4E, 0x06, 0x03,  // 123:590 '{' width:3px
-	0x02, 0x54, 0x02, 0x01,  // 124:596 '|' width:1px
-	0x02, 0x56, 0x06, 0x03,  // 125:598 '}' width:3px
-	0x02, 0x5C, 0x08, 0x04,  // 126:604 '~' width:4px
+	0x00, 0x00, 0x00, 0x04,  // 32:0 ' ' width:4px
+	0x00, 0x00, 0x04, 0x01,  // 33:0 '!' width:1px
+	0x00, 0x04, 0x07, 0x04,  // 34:4 '"' width:4px
+	0x00, 0x0B, 0x08, 0x05,  // 35:11 '#' width:5px
+	0x00, 0x13, 0x08, 0x05,  // 36:19 '$' width:5px
+	0x00, 0x1B, 0x0A, 0x07,  // 37:27 '%' width:7px
+	0x00, 0x25, 0x0D, 0x05,  // 38:37 '&' width:5px
+	0x00, 0x32, 0x04, 0x01,  // 39:50 ''' width:1px
+	0x00, 0x36, 0x06, 0x03,  // 40:54 '(' width:3px
+	0x00, 0x3C, 0x06, 0x03,  // 41:60 ')' width:3px
+	0x00, 0x42, 0x08, 0x05,  // 42:66 '*' width:5px
+	0x00, 0x4A, 0x08, 0x05,  // 43:74 '+' width:5px
+	0x00, 0x52, 0x05, 0x02,  // 44:82 ',' width:2px
+	0x00, 0x57, 0x07, 0x04,  // 45:87 '-' width:4px
+	0x00, 0x5E, 0x05, 0x02,  // 46:94 '.' width:2px
+	0x00, 0x63, 0x08, 0x05,  // 47:99 '/' width:5px
+	0x00, 0x6B, 0x08, 0x05,  // 48:107 '0' width:5px
+	0x00, 0x73, 0x06, 0x03,  // 49:115 '1' width:3px
+	0x00, 0x79, 0x08, 0x05,  // 50:121 '2' width:5px
+	0x00, 0x81, 0x08, 0x05,  // 51:129 '3' width:5px
+	0x00, 0x89, 0x08, 0x05,  // 52:137 '4' width:5px
+	0x00, 0x91, 0x08, 0x05,  // 53:145 '5' width:5px
+	0x00, 0x99, 0x08, 0x05,  // 54:153 '6' width:5px
+	0x00, 0xA1, 0x08, 0x05,  // 55:161 '7' width:5px
+	0x00, 0xA9, 0x08, 0x05,  // 56:169 '8' width:5px
+	0x00, 0xB1, 0x08, 0x05,  // 57:177 '9' width:5px
+	0x00, 0xB9, 0x05, 0x02,  // 58:185 ':' width:2px
+	0x00, 0xBE, 0x06, 0x03,  // 59:190 ';' width:3px
+	0x00, 0xC4, 0x08, 0x05,  // 60:196 '<' width:5px
+	0x00, 0xCC, 0x07, 0x04,  // 61:204 '=' width:4px
+	0x00, 0xD3, 0x08, 0x05,  // 62:211 '>' width:5px
+	0x00, 0xDB, 0x08, 0x05,  // 63:219 '?' width:5px
+	0x00, 0xE3, 0x08, 0x05,  // 64:227 '@' width:5px
+	0x00, 0xEB, 0x08, 0x05,  // 65:235 'A' width:5px
+	0x00, 0xF3, 0x08, 0x05,  // 66:243 'B' width:5px
+	0x00, 0xFB, 0x08, 0x05,  // 67:251 'C' width:5px
+	0x01, 0x03, 0x08, 0x05,  // 68:259 'D' width:5px
+	0x01, 0x0B, 0x08, 0x05,  // 69:267 'E' width:5px
+	0x01, 0x13, 0x08, 0x05,  // 70:275 'F' width:5px
+	0x01, 0x1B, 0x08, 0x05,  // 71:283 'G' width:5px
+	0x01, 0x23, 0x08, 0x05,  // 72:291 'H' width:5px
+	0x01, 0x2B, 0x06, 0x03,  // 73:299 'I' width:3px
+	0x01, 0x31, 0x08, 0x05,  // 74:305 'J' width:5px
+	0x01, 0x39, 0x08, 0x05,  // 75:313 'K' width:5px
+	0x01, 0x41, 0x08, 0x05,  // 76:321 'L' width:5px
+	0x01, 0x49, 0x0A, 0x07,  // 77:329 'M' width:7px
+	0x01, 0x53, 0x08, 0x05,  // 78:339 'N' width:5px
+	0x01, 0x5B, 0x08, 0x05,  // 79:347 'O' width:5px
+	0x01, 0x63, 0x08, 0x05,  // 80:355 'P' width:5px
+	0x01, 0x6B, 0x0D, 0x05,  // 81:363 'Q' width:5px
+	0x01, 0x78, 0x08, 0x05,  // 82:376 'R' width:5px
+	0x01, 0x80, 0x08, 0x05,  // 83:384 'S' width:5px
+	0x01, 0x88, 0x08, 0x05,  // 84:392 'T' width:5px
+	0x01, 0x90, 0x08, 0x05,  // 85:400 'U' width:5px
+	0x01, 0x98, 0x08, 0x05,  // 86:408 'V' width:5px
+	0x01, 0xA0, 0x0A, 0x07,  // 87:416 'W' width:7px
+	0x01, 0xAA, 0x08, 0x05,  // 88:426 'X' width:5px
+	0x01, 0xB2, 0x08, 0x05,  // 89:434 'Y' width:5px
+	0x01, 0xBA, 0x08, 0x05,  // 90:442 'Z' width:5px
+	0x01, 0xC2, 0x07, 0x04,  // 91:450 '[' width:4px
+	0x01, 0xC9, 0x08, 0x05,  // 92:457 'backslash' width:5px
+	0x01, 0xD1, 0x07, 0x04,  // 93:465 ']' width:4px
+	0x01, 0xD8, 0x08, 0x05,  // 94:472 '^' width:5px
+	0x01, 0xE0, 0x08, 0x05,  // 95:480 '_' width:5px
+	0x01, 0xE8, 0x05, 0x02,  // 96:488 '`' width:2px
+	0x01, 0xED, 0x06, 0x03,  // 123:493 '{' width:3px
+	0x01, 0xF3, 0x04, 0x01,  // 124:499 '|' width:1px
+	0x01, 0xF7, 0x06, 0x03,  // 125:503 '}' width:3px
+	0x01, 0xFD, 0x07, 0x04,  // 126:509 '~' width:4px
 
 	// Font Data:
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x24, 0x00,
-	0xFF, 0x00, 0x24, 0x00, 0xFF, 0x00, 0x24, 0x00, 0x5E, 0x00,
-	0x52, 0x00, 0xFF, 0x00, 0x52, 0x00, 0x72, 0x00, 0xC7, 0x00,
-	0x25, 0x00, 0x17, 0x00, 0x10, 0x00, 0xE8, 0x00, 0xA4, 0x00,
-	0xE3, 0x00, 0x76, 0x00, 0x89, 0x00, 0x89, 0x00, 0xF6, 0x00,
-	0x40, 0x01, 0x03, 0x00, 0x18, 0x00, 0x66, 0x00, 0x81, 0x00,
-	0x81, 0x00, 0x66, 0x00, 0x18, 0x00, 0x54, 0x00, 0x38, 0x00,
-	0xFE, 0x00, 0x38, 0x00, 0x54, 0x00, 0x10, 0x00, 0x10, 0x00,
-	0x7C, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x01, 0x80, 0x00,
-	0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0xC0, 0x00,
-	0xC0, 0x00, 0x80, 0x00, 0x60, 0x00, 0x18, 0x00, 0x06, 0x00,
-	0x01, 0x00, 0xFF, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
-	0xFF, 0x00, 0x82, 0x00, 0xFF, 0x00, 0x80, 0x00, 0xF9, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0x8F, 0x00, 0x89, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0xFF, 0x00, 0x3F, 0x00,
-	0x20, 0x00, 0x20, 0x00, 0xFC, 0x00, 0x20, 0x00, 0x8F, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0xF9, 0x00, 0xFF, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0xF9, 0x00, 0x03, 0x00,
-	0xC1, 0x00, 0x31, 0x00, 0x0D, 0x00, 0x03, 0x00, 0xFF, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0xFF, 0x00, 0x8F, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0xFF, 0x00, 0x66, 0x00,
-	0x66, 0x00, 0x80, 0x01, 0xCC, 0x00, 0x4C, 0x00, 0x10, 0x00,
-	0x18, 0x00, 0x24, 0x00, 0x42, 0x00, 0x81, 0x00, 0x24, 0x00,
-	0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x81, 0x00, 0x42, 0x00,
-	0x24, 0x00, 0x18, 0x00, 0x10, 0x00, 0x02, 0x00, 0x01, 0x00,
-	0xB9, 0x00, 0x09, 0x00, 0x06, 0x00, 0x7E, 0x00, 0x91, 0x00,
-	0xAD, 0x00, 0xA1, 0x00, 0x9E, 0x00, 0xFC, 0x00, 0x22, 0x00,
-	0x21, 0x00, 0x22, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x89, 0x00,
-	0x89, 0x00, 0x8E, 0x00, 0x70, 0x00, 0xFF, 0x00, 0x81, 0x00,
-	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xFF, 0x00, 0x81, 0x00,
-	0x81, 0x00, 0x42, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0x89, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x89, 0x00, 0xFF, 0x00, 0x09, 0x00,
-	0x09, 0x00, 0x09, 0x00, 0x01, 0x00, 0x7E, 0x00, 0x81, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x79, 0x00, 0xFF, 0x00, 0x08, 0x00,
-	0x08, 0x00, 0x08, 0x00, 0xFF, 0x00, 0x81, 0x00, 0xFF, 0x00,
-	0x81, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00,
-	0xFF, 0x00, 0xFF, 0x00, 0x08, 0x00, 0x14, 0x00, 0x22, 0x00,
-	0xC1, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
-	0x80, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x06, 0x00, 0x18, 0x00,
-	0x06, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00,
-	0x3C, 0x00, 0x40, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x81, 0x00,
-	0x81, 0x00, 0x81, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0x11, 0x00,
-	0x11, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x7E, 0x00, 0x81, 0x00,
-	0xC1, 0x00, 0x81, 0x00, 0x7E, 0x01, 0xFF, 0x00, 0x19, 0x00,
-	0x29, 0x00, 0x49, 0x00, 0x86, 0x00, 0x86, 0x00, 0x89, 0x00,
-	0x89, 0x00, 0x89, 0x00, 0x71, 0x00, 0x01, 0x00, 0x01, 0x00,
-	0xFF, 0x00, 0x01, 0x00, 0x01, 0x00, 0x7F, 0x00, 0x80, 0x00,
-	0x80, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0x00, 0x70, 0x00,
-	0x80, 0x00, 0x70, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x80, 0x00,
-	0x40, 0x00, 0x30, 0x00, 0x40, 0x00, 0x80, 0x00, 0xFF, 0x00,
-	0xC3, 0x00, 0x2C, 0x00, 0x10, 0x00, 0x2C, 0x00, 0xC3, 0x00,
-	0x03, 0x00, 0x0C, 0x00, 0xF0, 0x00, 0x0C, 0x00, 0x03, 0x00,
-	0xC1, 0x00, 0xA1, 0x00, 0x99, 0x00, 0x85, 0x00, 0x83, 0x00,
-	0xFF, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x01, 0x00,
-	0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0x80, 0x00, 0x81, 0x00,
-	0x81, 0x00, 0x81, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x02, 0x00,
-	0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x80, 0x00, 0x80, 0x00,
-	0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x01, 0x00, 0x02, 0x00,
-	0x18, 0x00, 0x5A, 0x00, 0xA5, 0x00, 0xF7, 0x00, 0xA5, 0x00,
-	0x5A, 0x00, 0x18, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00,
-	0x01, 0x00
+	0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x01, 0x24, 0xFF, 0x24, 0xFF, 0x24, 0x00,
+	0x00, 0x01, 0x5E, 0x52, 0xFF, 0x52, 0x72, 0x00, 0x00, 0x01,
+	0xC7, 0x25, 0x17, 0x10, 0xE8, 0xA4, 0xE3, 0x00, 0x00, 0x02,
+	0x76, 0x00, 0x89, 0x00, 0x89, 0x00, 0xF6, 0x00, 0x40, 0x01,
+	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x18, 0x66, 0x81,
+	0x00, 0x00, 0x01, 0x81, 0x66, 0x18, 0x00, 0x01, 0x01, 0x2A,
+	0x1C, 0x7F, 0x1C, 0x2A, 0x00, 0x02, 0x01, 0x04, 0x04, 0x1F,
+	0x04, 0x04, 0x00, 0x07, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x06, 0x01, 0x03, 0x03, 0x00,
+	0x00, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x00, 0x00, 0x01,
+	0xFF, 0x81, 0x81, 0x81, 0xFF, 0x00, 0x00, 0x01, 0x82, 0xFF,
+	0x80, 0x00, 0x00, 0x01, 0xF9, 0x89, 0x89, 0x89, 0x8F, 0x00,
+	0x00, 0x01, 0x89, 0x89, 0x89, 0x89, 0xFF, 0x00, 0x00, 0x01,
+	0x3F, 0x20, 0x20, 0xFC, 0x20, 0x00, 0x00, 0x01, 0x8F, 0x89,
+	0x89, 0x89, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0x89, 0x89, 0x89,
+	0xF9, 0x00, 0x00, 0x01, 0x03, 0xC1, 0x31, 0x0D, 0x03, 0x00,
+	0x00, 0x01, 0xFF, 0x89, 0x89, 0x89, 0xFF, 0x00, 0x00, 0x01,
+	0x8F, 0x89, 0x89, 0x89, 0xFF, 0x00, 0x01, 0x01, 0x33, 0x33,
+	0x00, 0x02, 0x01, 0x60, 0x33, 0x13, 0x00, 0x00, 0x01, 0x10,
+	0x18, 0x24, 0x42, 0x81, 0x00, 0x02, 0x01, 0x09, 0x09, 0x09,
+	0x09, 0x00, 0x00, 0x01, 0x81, 0x42, 0x24, 0x18, 0x10, 0x00,
+	0x00, 0x01, 0x02, 0x01, 0xB9, 0x09, 0x06, 0x00, 0x00, 0x01,
+	0x7E, 0x91, 0xAD, 0xA1, 0x9E, 0x00, 0x00, 0x01, 0xFC, 0x22,
+	0x21, 0x22, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x89, 0x89, 0x8E,
+	0x70, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x00,
+	0x00, 0x01, 0xFF, 0x81, 0x81, 0x42, 0x3C, 0x00, 0x00, 0x01,
+	0xFF, 0x89, 0x89, 0x89, 0x89, 0x00, 0x00, 0x01, 0xFF, 0x09,
+	0x09, 0x09, 0x01, 0x00, 0x00, 0x01, 0x7E, 0x81, 0x89, 0x89,
+	0x79, 0x00, 0x00, 0x01, 0xFF, 0x08, 0x08, 0x08, 0xFF, 0x00,
+	0x00, 0x01, 0x81, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xE0, 0x80,
+	0x80, 0x81, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x08, 0x14, 0x22,
+	0xC1, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x01, 0xFF, 0x01, 0x06, 0x18, 0x06, 0x01, 0xFF, 0x00,
+	0x00, 0x01, 0xFF, 0x02, 0x3C, 0x40, 0xFF, 0x00, 0x00, 0x01,
+	0x7E, 0x81, 0x81, 0x81, 0x7E, 0x00, 0x00, 0x01, 0xFF, 0x11,
+	0x11, 0x11, 0x0E, 0x00, 0x00, 0x02, 0x7E, 0x00, 0x81, 0x00,
+	0xC1, 0x00, 0x81, 0x00, 0x7E, 0x01, 0x00, 0x00, 0x01, 0xFF,
+	0x19, 0x29, 0x49, 0x86, 0x00, 0x00, 0x01, 0x86, 0x89, 0x89,
+	0x89, 0x71, 0x00, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01,
+	0x00, 0x00, 0x01, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00,
+	0x01, 0x0F, 0x70, 0x80, 0x70, 0x0F, 0x00, 0x00, 0x01, 0xFF,
+	0x80, 0x40, 0x30, 0x40, 0x80, 0xFF, 0x00, 0x00, 0x01, 0xC3,
+	0x2C, 0x10, 0x2C, 0xC3, 0x00, 0x00, 0x01, 0x03, 0x0C, 0xF0,
+	0x0C, 0x03, 0x00, 0x00, 0x01, 0xC1, 0xA1, 0x99, 0x85, 0x83,
+	0x00, 0x00, 0x01, 0xFF, 0x81, 0x81, 0x81, 0x00, 0x00, 0x01,
+	0x01, 0x06, 0x18, 0x60, 0x80, 0x00, 0x00, 0x01, 0x81, 0x81,
+	0x81, 0xFF, 0x00, 0x00, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04,
+	0x00, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x18, 0x5A, 0xA5, 0x00,
+	0x00, 0x01, 0xF7, 0x00, 0x00, 0x01, 0xA5, 0x5A, 0x18, 0x00,
+	0x00, 0x01, 0x02, 0x01, 0x02, 0x01
 };
 
 #endif // OLED_9_H
@@ -0,0 +1,126 @@
+/*
+
+  stroke.h stroke font for screen.
+  Font file generated by stroke_font.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _STROKE_H_
+#define _STROKE_H_
+
+/**
+ * Stroke font, 42 characters, 504 bytes
+ * Points are (x << 4) | y on a grid 8 units high, 0xFF lifts the pen, 0xFE ends the glyph
+ */
+static const uint8_t stroke_font[] = {
+	0x08, // Grid height: 8
+	0x2A, // Number of chars: 42
+	// Character codes
+	0x20, 0x2B, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
+	0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50,
+	0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+	// Jump table: offset MSB, offset LSB, width
+	0x00, 0x00, 0x03, // ' '
+	0x00, 0x01, 0x05, // '+'
+	0x00, 0x07, 0x04, // '-'
+	0x00, 0x0A, 0x02, // '.'
+	0x00, 0x0D, 0x05, // '/'
+	0x00, 0x10, 0x05, // '0'
+	0x00, 0x1D, 0x04, // '1'
+	0x00, 0x24, 0x05, // '2'
+	0x00, 0x2C, 0x05, // '3'
+	0x00, 0x3B, 0x05, // '4'
+	0x00, 0x40, 0x05, // '5'
+	0x00, 0x49, 0x05, // '6'
+	0x00, 0x54, 0x05, // '7'
+	0x00, 0x58, 0x05, // '8'
+	0x00, 0x6B, 0x05, // '9'
+	0x00, 0x76, 0x02, // ':'
+	0x00, 0x7C, 0x05, // 'A'
+	0x00, 0x85, 0x05, // 'B'
+	0x00, 0x93, 0x05, // 'C'
+	0x00, 0x9C, 0x05, // 'D'
+	0x00, 0xA4, 0x05, // 'E'
+	0x00, 0xAC, 0x05, // 'F'
+	0x00, 0xB3, 0x05, // 'G'
+	0x00, 0xBE, 0x05, // 'H'
+	0x00, 0xC7, 0x04, // 'I'
+	0x00, 0xD0, 0x05, // 'J'
+	0x00, 0xD6, 0x05, // 'K'
+	0x00, 0xDF, 0x05, // 'L'
+	0x00, 0xE3, 0x05, // 'M'
+	0x00, 0xE9, 0x05, // 'N'
+	0x00, 0xEE, 0x05, // 'O'
+	0x00, 0xF8, 0x05, // 'P'
+	0x01, 0x00, 0x05, // 'Q'
+	0x01, 0x0D, 0x05, // 'R'
+	0x01, 0x18, 0x05, // 'S'
+	0x01, 0x25, 0x05, // 'T'
+	0x01, 0x2B, 0x05, // 'U'
+	0x01, 0x32, 0x05, // 'V'
+	0x01, 0x36, 0x05, // 'W'
+	0x01, 0x3C, 0x05, // 'X'
+	0x01, 0x42, 0x05, // 'Y'
+	0x01, 0x49, 0x05, // 'Z'
+	// Strokes
+	0xFE, // ' '
+	0x22, 0x26, 0xFF, 0x04, 0x44, 0xFE, // '+'
+	0x14, 0x34, 0xFE, // '-'
+	0x17, 0x18, 0xFE, // '.'
+	0x08, 0x40, 0xFE, // '/'
+	0x10, 0x30, 0x41, 0x47, 0x38, 0x18, 0x07, 0x01, 0x10, 0xFF, 0x41, 0x07, 0xFE, // '0'
+	0x11, 0x20, 0x28, 0xFF, 0x18, 0x38, 0xFE, // '1'
+	0x01, 0x10, 0x30, 0x41, 0x43, 0x08, 0x48, 0xFE, // '2'
+	0x01, 0x10, 0x30, 0x41, 0x43, 0x34, 0x14, 0xFF, 0x34, 0x45, 0x47, 0x38, 0x18, 0x07, 0xFE, // '3'
+	0x38, 0x30, 0x06, 0x46, 0xFE, // '4'
+	0x40, 0x00, 0x04, 0x34, 0x45, 0x47, 0x38, 0x08, 0xFE, // '5'
+	0x30, 0x10, 0x01, 0x07, 0x18, 0x38, 0x47, 0x45, 0x34, 0x04, 0xFE, // '6'
+	0x00, 0x40, 0x18, 0xFE, // '7'
+	0x10, 0x30, 0x41, 0x43, 0x34, 0x14, 0x03, 0x01, 0x10, 0xFF, 0x14, 0x05, 0x07, 0x18, 0x38, 0x47, 0x45, 0x34, 0xFE, // '8'
+	0x44, 0x14, 0x03, 0x01, 0x10, 0x30, 0x41, 0x47, 0x38, 0x18, 0xFE, // '9'
+	0x12, 0x13, 0xFF, 0x16, 0x17, 0xFE, // ':'
+	0x08, 0x02, 0x20, 0x42, 0x48, 0xFF, 0x05, 0x45, 0xFE, // 'A'
+	0x08, 0x00, 0x30, 0x41, 0x43, 0x34, 0x04, 0xFF, 0x34, 0x45, 0x47, 0x38, 0x08, 0xFE, // 'B'
+	0x41, 0x30, 0x10, 0x01, 0x07, 0x18, 0x38, 0x47, 0xFE, // 'C'
+	0x00, 0x30, 0x41, 0x47, 0x38, 0x08, 0x00, 0xFE, // 'D'
+	0x40, 0x00, 0x08, 0x48, 0xFF, 0x04, 0x34, 0xFE, // 'E'
+	0x40, 0x00, 0x08, 0xFF, 0x04, 0x34, 0xFE, // 'F'
+	0x41, 0x30, 0x10, 0x01, 0x07, 0x18, 0x38, 0x47, 0x44, 0x24, 0xFE, // 'G'
+	0x00, 0x08, 0xFF, 0x40, 0x48, 0xFF, 0x04, 0x44, 0xFE, // 'H'
+	0x10, 0x30, 0xFF, 0x20, 0x28, 0xFF, 0x18, 0x38, 0xFE, // 'I'
+	0x40, 0x47, 0x38, 0x18, 0x07, 0xFE, // 'J'
+	0x00, 0x08, 0xFF, 0x40, 0x05, 0xFF, 0x14, 0x48, 0xFE, // 'K'
+	0x00, 0x08, 0x48, 0xFE, // 'L'
+	0x08, 0x00, 0x24, 0x40, 0x48, 0xFE, // 'M'
+	0x08, 0x00, 0x48, 0x40, 0xFE, // 'N'
+	0x10, 0x30, 0x41, 0x47, 0x38, 0x18, 0x07, 0x01, 0x10, 0xFE, // 'O'
+	0x08, 0x00, 0x30, 0x41, 0x43, 0x34, 0x04, 0xFE, // 'P'
+	0x10, 0x30, 0x41, 0x47, 0x38, 0x18, 0x07, 0x01, 0x10, 0xFF, 0x26, 0x48, 0xFE, // 'Q'
+	0x08, 0x00, 0x30, 0x41, 0x43, 0x34, 0x04, 0xFF, 0x24, 0x48, 0xFE, // 'R'
+	0x41, 0x30, 0x10, 0x01, 0x03, 0x14, 0x34, 0x45, 0x47, 0x38, 0x18, 0x07, 0xFE, // 'S'
+	0x00, 0x40, 0xFF, 0x20, 0x28, 0xFE, // 'T'
+	0x00, 0x07, 0x18, 0x38, 0x47, 0x40, 0xFE, // 'U'
+	0x00, 0x28, 0x40, 0xFE, // 'V'
+	0x00, 0x18, 0x24, 0x38, 0x40, 0xFE, // 'W'
+	0x00, 0x48, 0xFF, 0x40, 0x08, 0xFE, // 'X'
+	0x00, 0x24, 0x40, 0xFF, 0x24, 0x28, 0xFE, // 'Y'
+	0x00, 0x40, 0x08, 0x48, 0xFE // 'Z'
+};
+#endif // _STROKE_H_
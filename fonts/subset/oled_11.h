@@ -0,0 +1,99 @@
+/*
+ * Font Name: oled_11 (subset of oled_11.h)
+ * Font Width: 9 (maximum width of any character)
+ * Font Height: 11
+ * Character Set: Subset (17 characters): ACDEGHIJKLMNOPRSU
+ * Character Spacing: 2 pixels
+ * Data Size: 302 bytes
+ *
+ * Font Data Format: see font_converter.py
+ * - First 5 bytes: max width, height, flags | char count MSB, char count LSB, spacing
+ * - Direct Index (flag 0x20): first code F, last code L, then L - F + 1 bytes
+ *   giving the jump table index of each code, 0xFF if not in font
+ * - Jump Table: 4 bytes per character [MSB, LSB, size, width]
+ * - Font Data: Bitmap data for all characters
+ *
+ * This file was automatically generated by font_subset on 2026-10-18
+ * Created by Luc LEBOSSE
+ *
+ * This font data is licensed under the GNU LGPL v3 License.
+ */
+
+#ifndef OLED_11_H
+#define OLED_11_H
+
+const char oled_11[] PROGMEM = {
+	0x09, // Width: 9 (maximum)
+	0x0B, // Height: 11
+	0x20, // Flags | Number of Chars MSB
+	0x11, // Number of Chars LSB: 17
+	0x02, // Character Spacing: 2 pixels
+
+	// Direct Index: first code, last code, then index of each code
+	0x41, 0x55, // 'A' to 'U'
+	0x00, // 'A'
+	0xFF, // 'B' (not in font)
+	0x01, // 'C'
+	0x02, // 'D'
+	0x03, // 'E'
+	0xFF, // 'F' (not in font)
+	0x04, // 'G'
+	0x05, // 'H'
+	0x06, // 'I'
+	0x07, // 'J'
+	0x08, // 'K'
+	0x09, // 'L'
+	0x0A, // 'M'
+	0x0B, // 'N'
+	0x0C, // 'O'
+	0x0D, // 'P'
+	0xFF, // 'Q' (not in font)
+	0x0E, // 'R'
+	0x0F, // 'S'
+	0xFF, // 'T' (not in font)
+	0x10, // 'U'
+
+	// Jump Table: Format is [MSB, LSB, size, width]
+	0x00, 0x00, 0x0C, 0x06,  // 65:0 'A' width:6px
+	0x00, 0x0C, 0x0C, 0x06,  // 67:12 'C' width:6px
+	0x00, 0x18, 0x0C, 0x06,  // 68:24 'D' width:6px
+	0x00, 0x24, 0x0C, 0x06,  // 69:36 'E' width:6px
+	0x00, 0x30, 0x0C, 0x06,  // 71:48 'G' width:6px
+	0x00, 0x3C, 0x0C, 0x06,  // 72:60 'H' width:6px
+	0x00, 0x48, 0x06, 0x03,  // 73:72 'I' width:3px
+	0x00, 0x4E, 0x0C, 0x06,  // 74:78 'J' width:6px
+	0x00, 0x5A, 0x0C, 0x06,  // 75:90 'K' width:6px
+	0x00, 0x66, 0x0C, 0x06,  // 76:102 'L' width:6px
+	0x00, 0x72, 0x12, 0x09,  // 77:114 'M' width:9px
+	0x00, 0x84, 0x0C, 0x06,  // 78:132 'N' width:6px
+	0x00, 0x90, 0x0C, 0x06,  // 79:144 'O' width:6px
+	0x00, 0x9C, 0x0C, 0x06,  // 80:156 'P' width:6px
+	0x00, 0xA8, 0x0E, 0x07,  // 82:168 'R' width:7px
+	0x00, 0xB6, 0x0C, 0x06,  // 83:182 'S' width:6px
+	0x00, 0xC2, 0x0C, 0x06,  // 85:194 'U' width:6px
+
+	// Font Data:
+	0xFC, 0x03, 0x42, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00,
+	0xFC, 0x03, 0xFF, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x01, 0x02, 0xFF, 0x03, 0x01, 0x02, 0x01, 0x02,
+	0x02, 0x01, 0xCC, 0x00, 0x30, 0x00, 0xFF, 0x03, 0x11, 0x02,
+	0x11, 0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x02, 0xFE, 0x01,
+	0x01, 0x02, 0x01, 0x02, 0x11, 0x02, 0x11, 0x02, 0xF1, 0x01,
+	0xFF, 0x03, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+	0xFF, 0x03, 0x01, 0x02, 0xFF, 0x03, 0x01, 0x02, 0x80, 0x03,
+	0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x01, 0x02, 0xFF, 0x03,
+	0xFF, 0x03, 0x10, 0x00, 0x28, 0x00, 0xC4, 0x00, 0x02, 0x00,
+	0x01, 0x03, 0xFF, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+	0x00, 0x02, 0x00, 0x02, 0xFF, 0x03, 0x02, 0x00, 0x0C, 0x00,
+	0x30, 0x00, 0x40, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x02, 0x00,
+	0xFF, 0x03, 0xFF, 0x03, 0x02, 0x00, 0x1C, 0x00, 0xE0, 0x00,
+	0x00, 0x01, 0xFF, 0x03, 0xFE, 0x01, 0x01, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x01, 0x02, 0xFE, 0x01, 0xFF, 0x03, 0x21, 0x00,
+	0x21, 0x00, 0x21, 0x00, 0x31, 0x00, 0x0E, 0x00, 0xFF, 0x03,
+	0x11, 0x00, 0x31, 0x00, 0x51, 0x00, 0x91, 0x00, 0x11, 0x01,
+	0x0E, 0x02, 0x0E, 0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x02,
+	0x11, 0x02, 0xE1, 0x01, 0xFF, 0x01, 0x00, 0x02, 0x00, 0x02,
+	0x00, 0x02, 0x00, 0x02, 0xFF, 0x01
+};
+
+#endif // OLED_11_H
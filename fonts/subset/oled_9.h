@@ -0,0 +1,139 @@
+/*
+ * Font Name: oled_9 (subset of oled_9.h)
+ * Font Width: 7 (maximum width of any character)
+ * Font Height: 9
+ * Character Set: Subset (23 characters):  -.0123456789:ABCUVWXYZ
+ * Character Spacing: 1 pixels
+ * Data Size: 327 bytes
+ *
+ * Font Data Format: see font_converter.py
+ * - First 5 bytes: max width, height, flags | char count MSB, char count LSB, spacing
+ * - Direct Index (flag 0x20): first code F, last code L, then L - F + 1 bytes
+ *   giving the jump table index of each code, 0xFF if not in font
+ * - Jump Table: 4 bytes per character [MSB, LSB, size, width]
+ * - Font Data: Bitmap data for all characters (cropped, flag 0x80)
+ *
+ * This file was automatically generated by font_subset on 2026-10-18
+ * Created by Luc LEBOSSE
+ *
+ * This font data is licensed under the GNU LGPL v3 License.
+ */
+
+#ifndef OLED_9_H
+#define OLED_9_H
+
+const char oled_9[] PROGMEM = {
+	0x07, // Width: 7 (maximum)
+	0x09, // Height: 9
+	0xA0, // Flags | Number of Chars MSB
+	0x17, // Number of Chars LSB: 23
+	0x01, // Character Spacing: 1 pixels
+
+	// Direct Index: first code, last code, then index of each code
+	0x20, 0x5A, // ' ' to 'Z'
+	0x00, // ' '
+	0xFF, // '!' (not in font)
+	0xFF, // '"' (not in font)
+	0xFF, // '#' (not in font)
+	0xFF, // '$' (not in font)
+	0xFF, // '%' (not in font)
+	0xFF, // '&' (not in font)
+	0xFF, // ''' (not in font)
+	0xFF, // '(' (not in font)
+	0xFF, // ')' (not in font)
+	0xFF, // '*' (not in font)
+	0xFF, // '+' (not in font)
+	0xFF, // ',' (not in font)
+	0x01, // '-'
+	0x02, // '.'
+	0xFF, // '/' (not in font)
+	0x03, // '0'
+	0x04, // '1'
+	0x05, // '2'
+	0x06, // '3'
+	0x07, // '4'
+	0x08, // '5'
+	0x09, // '6'
+	0x0A, // '7'
+	0x0B, // '8'
+	0x0C, // '9'
+	0x0D, // ':'
+	0xFF, // ';' (not in font)
+	0xFF, // '<' (not in font)
+	0xFF, // '=' (not in font)
+	0xFF, // '>' (not in font)
+	0xFF, // '?' (not in font)
+	0xFF, // '@' (not in font)
+	0x0E, // 'A'
+	0x0F, // 'B'
+	0x10, // 'C'
+	0xFF, // 'D' (not in font)
+	0xFF, // 'E' (not in font)
+	0xFF, // 'F' (not in font)
+	0xFF, // 'G' (not in font)
+	0xFF, // 'H' (not in font)
+	0xFF, // 'I' (not in font)
+	0xFF, // 'J' (not in font)
+	0xFF, // 'K' (not in font)
+	0xFF, // 'L' (not in font)
+	0xFF, // 'M' (not in font)
+	0xFF, // 'N' (not in font)
+	0xFF, // 'O' (not in font)
+	0xFF, // 'P' (not in font)
+	0xFF, // 'Q' (not in font)
+	0xFF, // 'R' (not in font)
+	0xFF, // 'S' (not in font)
+	0xFF, // 'T' (not in font)
+	0x11, // 'U'
+	0x12, // 'V'
+	0x13, // 'W'
+	0x14, // 'X'
+	0x15, // 'Y'
+	0x16, // 'Z'
+
+	// Jump Table: Format is [MSB, LSB, size, width]
+	0x00, 0x00, 0x00, 0x04,  // 32:0 ' ' width:4px
+	0x00, 0x00, 0x07, 0x04,  // 45:0 '-' width:4px
+	0x00, 0x07, 0x05, 0x02,  // 46:7 '.' width:2px
+	0x00, 0x0C, 0x08, 0x05,  // 48:12 '0' width:5px
+	0x00, 0x14, 0x06, 0x03,  // 49:20 '1' width:3px
+	0x00, 0x1A, 0x08, 0x05,  // 50:26 '2' width:5px
+	0x00, 0x22, 0x08, 0x05,  // 51:34 '3' width:5px
+	0x00, 0x2A, 0x08, 0x05,  // 52:42 '4' width:5px
+	0x00, 0x32, 0x08, 0x05,  // 53:50 '5' width:5px
+	0x00, 0x3A, 0x08, 0x05,  // 54:58 '6' width:5px
+	0x00, 0x42, 0x08, 0x05,  // 55:66 '7' width:5px
+	0x00, 0x4A, 0x08, 0x05,  // 56:74 '8' width:5px
+	0x00, 0x52, 0x08, 0x05,  // 57:82 '9' width:5px
+	0x00, 0x5A, 0x05, 0x02,  // 58:90 ':' width:2px
+	0x00, 0x5F, 0x08, 0x05,  // 65:95 'A' width:5px
+	0x00, 0x67, 0x08, 0x05,  // 66:103 'B' width:5px
+	0x00, 0x6F, 0x08, 0x05,  // 67:111 'C' width:5px
+	0x00, 0x77, 0x08, 0x05,  // 85:119 'U' width:5px
+	0x00, 0x7F, 0x08, 0x05,  // 86:127 'V' width:5px
+	0x00, 0x87, 0x0A, 0x07,  // 87:135 'W' width:7px
+	0x00, 0x91, 0x08, 0x05,  // 88:145 'X' width:5px
+	0x00, 0x99, 0x08, 0x05,  // 89:153 'Y' width:5px
+	0x00, 0xA1, 0x08, 0x05,  // 90:161 'Z' width:5px
+
+	// Font Data:
+	0x00, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x06, 0x01,
+	0x03, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x81, 0x81, 0xFF,
+	0x00, 0x00, 0x01, 0x82, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xF9,
+	0x89, 0x89, 0x89, 0x8F, 0x00, 0x00, 0x01, 0x89, 0x89, 0x89,
+	0x89, 0xFF, 0x00, 0x00, 0x01, 0x3F, 0x20, 0x20, 0xFC, 0x20,
+	0x00, 0x00, 0x01, 0x8F, 0x89, 0x89, 0x89, 0xF9, 0x00, 0x00,
+	0x01, 0xFF, 0x89, 0x89, 0x89, 0xF9, 0x00, 0x00, 0x01, 0x03,
+	0xC1, 0x31, 0x0D, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x89, 0x89,
+	0x89, 0xFF, 0x00, 0x00, 0x01, 0x8F, 0x89, 0x89, 0x89, 0xFF,
+	0x00, 0x01, 0x01, 0x33, 0x33, 0x00, 0x00, 0x01, 0xFC, 0x22,
+	0x21, 0x22, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x89, 0x89, 0x8E,
+	0x70, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x00,
+	0x00, 0x01, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x01,
+	0x0F, 0x70, 0x80, 0x70, 0x0F, 0x00, 0x00, 0x01, 0xFF, 0x80,
+	0x40, 0x30, 0x40, 0x80, 0xFF, 0x00, 0x00, 0x01, 0xC3, 0x2C,
+	0x10, 0x2C, 0xC3, 0x00, 0x00, 0x01, 0x03, 0x0C, 0xF0, 0x0C,
+	0x03, 0x00, 0x00, 0x01, 0xC1, 0xA1, 0x99, 0x85, 0x83
+};
+
+#endif // OLED_9_H
@@ -0,0 +1,55 @@
+/*
+
+  icons.h icons for screen.
+  Icon sheet generated by icon_converter.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _ICONS_H_
+#define _ICONS_H_
+
+// Icon ids
+#define ICONS_NETWORK 0 // 8x8
+#define ICONS_SD 1 // 8x8
+#define ICONS_SPINDLE 2 // 8x8
+#define ICONS_COOLANT 3 // 8x8
+#define ICONS_LOCK 4 // 8x8
+#define ICONS_COUNT 5
+
+static const uint8_t icons[] = {
+	0x05, // Icon count: 5
+	// Index: offset MSB, offset LSB, width, pages
+	0x00, 0x00, 0x08, 0x01, // NETWORK
+	0x00, 0x08, 0x08, 0x01, // SD
+	0x00, 0x10, 0x08, 0x01, // SPINDLE
+	0x00, 0x18, 0x08, 0x01, // COOLANT
+	0x00, 0x20, 0x08, 0x01, // LOCK
+	// NETWORK
+	0x02, 0x09, 0x25, 0xD5, 0xD5, 0x25, 0x09, 0x02,
+	// SD
+	0x00, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFE, 0xFC,
+	// SPINDLE
+	0x18, 0x5A, 0x3C, 0xE7, 0xE7, 0x3C, 0x5A, 0x18,
+	// COOLANT
+	0x00, 0x70, 0xFC, 0xDF, 0xFC, 0x70, 0x00, 0x00,
+	// LOCK
+	0xF8, 0xFE, 0xF9, 0xC9, 0xC9, 0xF9, 0xFE, 0xF8
+};
+#endif // _ICONS_H_
@@ -0,0 +1,109 @@
+/*
+
+  layout_128x32.h layout of a 128 x 32 display.
+  Layout file generated by layout_generator.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _LAYOUT_128X32_H_
+#define _LAYOUT_128X32_H_
+
+/**
+ * Fields of a 128 x 32 display, drawn in order
+ * type, flags, axis, font, color, align, after, before, x, y, line, width, height
+ */
+#if N_AXIS == 1
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 18, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 18, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 18, 0, 5, -1 } // 5
+};
+#elif N_AXIS == 2
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 14, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 14, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 14, 0, 5, -1 }, // 5
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 24, 0, 0, 0 }, // 6
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 24, 0, 0, 0 }, // 7
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 24, 0, 5, -1 } // 8
+};
+#elif N_AXIS == 3
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 14, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 55, 14, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 57, 14, 0, 5, -1 }, // 5
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 24, 0, 0, 0 }, // 6
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 55, 24, 0, 0, 0 }, // 7
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 57, 24, 0, 5, -1 }, // 8
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 65, 14, 0, 0, 0 }, // 9
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 120, 14, 0, 0, 0 }, // 10
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 122, 14, 0, 5, -1 } // 11
+};
+#elif N_AXIS == 4
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 14, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 55, 14, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 57, 14, 0, 5, -1 }, // 5
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 24, 0, 0, 0 }, // 6
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 55, 24, 0, 0, 0 }, // 7
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 57, 24, 0, 5, -1 }, // 8
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 65, 14, 0, 0, 0 }, // 9
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 120, 14, 0, 0, 0 }, // 10
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 122, 14, 0, 5, -1 }, // 11
+	{ LAYOUT_LABEL, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 65, 24, 0, 0, 0 }, // 12
+	{ LAYOUT_POSITION, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 120, 24, 0, 0, 0 }, // 13
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 122, 24, 0, 5, -1 } // 14
+};
+#elif N_AXIS == 5
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 5, 0, 0, 0 }, // 0
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 55, 5, 0, 0, 0 }, // 1
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 57, 5, 0, 5, -1 }, // 2
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 14, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 55, 14, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 57, 14, 0, 5, -1 }, // 5
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 23, 0, 0, 0 }, // 6
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 55, 23, 0, 0, 0 }, // 7
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 57, 23, 0, 5, -1 }, // 8
+	{ LAYOUT_LABEL, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 65, 5, 0, 0, 0 }, // 9
+	{ LAYOUT_POSITION, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 120, 5, 0, 0, 0 }, // 10
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 122, 5, 0, 5, -1 }, // 11
+	{ LAYOUT_LABEL, 0, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 65, 14, 0, 0, 0 }, // 12
+	{ LAYOUT_POSITION, 0, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 120, 14, 0, 0, 0 }, // 13
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 122, 14, 0, 5, -1 }, // 14
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 66, 23, 0, 0, 0 } // 15
+};
+#else // N_AXIS >= 6
+#error "No 128 x 32 layout for 6 axes"
+#endif // N_AXIS
+
+#endif // _LAYOUT_128X32_H_
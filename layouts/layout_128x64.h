@@ -0,0 +1,146 @@
+/*
+
+  layout_128x64.h layout of a 128 x 64 display.
+  Layout file generated by layout_generator.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _LAYOUT_128X64_H_
+#define _LAYOUT_128X64_H_
+
+/**
+ * Fields of a 128 x 64 display, drawn in order
+ * type, flags, axis, font, color, align, after, before, x, y, line, width, height
+ */
+#if N_AXIS == 1
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 29, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 29, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 29, 0, 5, -1 } // 5
+};
+#elif N_AXIS == 2
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 24, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 24, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 24, 0, 5, -1 }, // 5
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 34, 1, 0, 0 }, // 6
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 34, 1, 0, 0 }, // 7
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 34, 1, 5, -1 } // 8
+};
+#elif N_AXIS == 3
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 20, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 20, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 20, 0, 5, -1 }, // 5
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 26, 1, 0, 0 }, // 6
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 26, 1, 0, 0 }, // 7
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 26, 1, 5, -1 }, // 8
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 32, 2, 0, 0 }, // 9
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 105, 32, 2, 0, 0 }, // 10
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 110, 32, 2, 5, -1 } // 11
+};
+#elif N_AXIS == 4
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 17, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 85, 17, 0, 0, 0 }, // 4
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 90, 17, 0, 5, -1 }, // 5
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 20, 1, 0, 0 }, // 6
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 85, 20, 1, 0, 0 }, // 7
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 90, 20, 1, 5, -1 }, // 8
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 23, 2, 0, 0 }, // 9
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 85, 23, 2, 0, 0 }, // 10
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 90, 23, 2, 5, -1 }, // 11
+	{ LAYOUT_LABEL, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 15, 26, 3, 0, 0 }, // 12
+	{ LAYOUT_POSITION, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 85, 26, 3, 0, 0 }, // 13
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 90, 26, 3, 5, -1 } // 14
+};
+#elif N_AXIS == 5
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 16, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 60, 16, 0, 0, 0 }, // 4
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 28, 0, 0, 0 }, // 5
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 60, 28, 0, 0, 0 }, // 6
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 40, 0, 0, 0 }, // 7
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 60, 40, 0, 0, 0 }, // 8
+	{ LAYOUT_LABEL, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 66, 16, 0, 0, 0 }, // 9
+	{ LAYOUT_POSITION, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 16, 0, 0, 0 }, // 10
+	{ LAYOUT_LABEL, 0, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 66, 28, 0, 0, 0 }, // 11
+	{ LAYOUT_POSITION, 0, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 28, 0, 0, 0 }, // 12
+	{ LAYOUT_FILL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 53, 0, 128, 11 }, // 13
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 54, 0, 0, 0 }, // 14
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 14, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 15
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 21, 54, 0, 0, 0 }, // 16
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 16, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 17
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 41, 54, 0, 0, 0 }, // 18
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 18, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 19
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 61, 54, 0, 0, 0 }, // 20
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 20, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 21
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 81, 54, 0, 0, 0 }, // 22
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 22, LAYOUT_NONE, 1, 54, 0, 5, 8 } // 23
+};
+#else // N_AXIS >= 6
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_IP, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 2, 0, 0, 0 }, // 1
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, 1, 4, 0, 0, 2, 0 }, // 2
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 16, 0, 0, 0 }, // 3
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 60, 16, 0, 0, 0 }, // 4
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 28, 0, 0, 0 }, // 5
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 60, 28, 0, 0, 0 }, // 6
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 40, 0, 0, 0 }, // 7
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 60, 40, 0, 0, 0 }, // 8
+	{ LAYOUT_LABEL, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 66, 16, 0, 0, 0 }, // 9
+	{ LAYOUT_POSITION, 0, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 16, 0, 0, 0 }, // 10
+	{ LAYOUT_LABEL, 0, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 66, 28, 0, 0, 0 }, // 11
+	{ LAYOUT_POSITION, 0, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 28, 0, 0, 0 }, // 12
+	{ LAYOUT_LABEL, 0, 5, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 66, 40, 0, 0, 0 }, // 13
+	{ LAYOUT_POSITION, 0, 5, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 127, 40, 0, 0, 0 }, // 14
+	{ LAYOUT_FILL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 53, 0, 128, 11 }, // 15
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 54, 0, 0, 0 }, // 16
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 16, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 17
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 21, 54, 0, 0, 0 }, // 18
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 18, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 19
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 41, 54, 0, 0, 0 }, // 20
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 20, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 21
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 61, 54, 0, 0, 0 }, // 22
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 3, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 22, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 23
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 81, 54, 0, 0, 0 }, // 24
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 4, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 24, LAYOUT_NONE, 1, 54, 0, 5, 8 }, // 25
+	{ LAYOUT_LABEL, LAYOUT_ENDSTOP_ONLY, 5, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 101, 54, 0, 0, 0 }, // 26
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY, 5, DISPLAY_FONT_SMALL, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_AFTER, 26, LAYOUT_NONE, 1, 54, 0, 5, 8 } // 27
+};
+#endif // N_AXIS
+
+#endif // _LAYOUT_128X64_H_
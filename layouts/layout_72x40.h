@@ -0,0 +1,73 @@
+/*
+
+  layout_72x40.h layout of a 72 x 40 display.
+  Layout file generated by layout_generator.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _LAYOUT_72X40_H_
+#define _LAYOUT_72X40_H_
+
+/**
+ * Fields of a 72 x 40 display, drawn in order
+ * type, flags, axis, font, color, align, after, before, x, y, line, width, height
+ */
+#if N_AXIS == 1
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, LAYOUT_NONE, 4, 0, 0, 2, 0 }, // 1
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 23, 0, 0, 0 }, // 2
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 65, 23, 0, 0, 0 }, // 3
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 67, 23, 0, 5, -1 } // 4
+};
+#elif N_AXIS == 2
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, LAYOUT_NONE, 4, 0, 0, 2, 0 }, // 1
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 17, 0, 0, 0 }, // 2
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 65, 17, 0, 0, 0 }, // 3
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 67, 17, 0, 5, -1 }, // 4
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 29, 0, 0, 0 }, // 5
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 65, 29, 0, 0, 0 }, // 6
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 67, 29, 0, 5, -1 } // 7
+};
+#elif N_AXIS == 3
+static const layout_field_t layout_fields[] = {
+	{ LAYOUT_STATE, 0, 0, DISPLAY_FONT_BIG, DISPLAY_COLOR_BLACK, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 1, 1, 0, 0, 0 }, // 0
+	{ LAYOUT_ICONS, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_AFTER, 0, LAYOUT_NONE, 4, 0, 0, 2, 0 }, // 1
+	{ LAYOUT_LABEL, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 14, 0, 0, 0 }, // 2
+	{ LAYOUT_POSITION, 0, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 65, 14, 0, 0, 0 }, // 3
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 0, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 67, 14, 0, 5, -1 }, // 4
+	{ LAYOUT_LABEL, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 23, 0, 0, 0 }, // 5
+	{ LAYOUT_POSITION, 0, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 65, 23, 0, 0, 0 }, // 6
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 1, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 67, 23, 0, 5, -1 }, // 7
+	{ LAYOUT_LABEL, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 0, 32, 0, 0, 0 }, // 8
+	{ LAYOUT_POSITION, 0, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_RIGHT, LAYOUT_NONE, LAYOUT_NONE, 65, 32, 0, 0, 0 }, // 9
+	{ LAYOUT_ENDSTOP, LAYOUT_ENDSTOP_ONLY | LAYOUT_FONT_HEIGHT, 2, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, LAYOUT_ALIGN_LEFT, LAYOUT_NONE, LAYOUT_NONE, 67, 32, 0, 5, -1 } // 10
+};
+#elif N_AXIS == 4
+#error "No 72 x 40 layout for 4 axes"
+#elif N_AXIS == 5
+#error "No 72 x 40 layout for 5 axes"
+#else // N_AXIS >= 6
+#error "No 72 x 40 layout for 6 axes"
+#endif // N_AXIS
+
+#endif // _LAYOUT_72X40_H_
@@ -31,10 +31,161 @@
 #if DISPLAY_ENABLE == 33
 #include "oled_display.h"
 
+// Fonts loadable from the controller file system (SD card or littlefs)
+#ifndef DISPLAY_FONT_FILES
+#define DISPLAY_FONT_FILES 0
+#endif //DISPLAY_FONT_FILES
+
+// Boot logo and images loadable from the controller file system
+#ifndef DISPLAY_IMAGE_FILES
+#define DISPLAY_IMAGE_FILES 0
+#endif //DISPLAY_IMAGE_FILES
+
+#if DISPLAY_FONT_FILES || DISPLAY_IMAGE_FILES
+#include "grbl/vfs.h"
+#endif //DISPLAY_FONT_FILES || DISPLAY_IMAGE_FILES
+
+// Boot logo file, drawn instead of the compiled logo when found
+#ifndef DISPLAY_LOGO_FILE
+#define DISPLAY_LOGO_FILE "/oled/logo.bin"
+#endif //DISPLAY_LOGO_FILE
+
+// Compile the default logo, set to 0 to only use the logo file
+#ifndef DISPLAY_LOGO_COMPILED
+#define DISPLAY_LOGO_COMPILED 1
+#endif //DISPLAY_LOGO_COMPILED
+
+// Size of the read buffer for image files
+#ifndef DISPLAY_IMAGE_FILE_BUFFER
+#define DISPLAY_IMAGE_FILE_BUFFER 32
+#endif //DISPLAY_IMAGE_FILE_BUFFER
+
+// Unchanged columns splitting a changed page in 2 refresh spans, a span costs 3 commands
+#ifndef DISPLAY_REFRESH_SPAN_GAP
+#define DISPLAY_REFRESH_SPAN_GAP 10
+#endif //DISPLAY_REFRESH_SPAN_GAP
+
+// Maximum data bytes of an I2C transaction, longer transfers are split so other devices can use the bus between them, 0 for no limit
+#ifndef DISPLAY_I2C_CHUNK
+#define DISPLAY_I2C_CHUNK 32
+#endif //DISPLAY_I2C_CHUNK
+
+// Contrast of the dimmed display
+#ifndef DISPLAY_DIM_CONTRAST
+#define DISPLAY_DIM_CONTRAST 0x08
+#endif //DISPLAY_DIM_CONTRAST
+
+// Page and column commands sent before the data of a span, in the same transaction
+#define SPAN_PREFIX_SIZE 6
+
+// Staging buffer of transfers with several segments when no transfer handler is set
+#if DISPLAY_I2C_CHUNK
+#define DISPLAY_STAGING_SIZE (SPAN_PREFIX_SIZE + DISPLAY_I2C_CHUNK)
+#else
+#define DISPLAY_STAGING_SIZE (SPAN_PREFIX_SIZE + 128)
+#endif //DISPLAY_I2C_CHUNK
+
+// Play images/boot_animation.h (see png_converter.py --animation) instead of the boot logo
+#ifndef DISPLAY_BOOT_ANIMATION
+#define DISPLAY_BOOT_ANIMATION 0
+#endif //DISPLAY_BOOT_ANIMATION
+
+// Number of times the boot animation is played
+#ifndef DISPLAY_BOOT_ANIMATION_REPEAT
+#define DISPLAY_BOOT_ANIMATION_REPEAT 1
+#endif //DISPLAY_BOOT_ANIMATION_REPEAT
+
 #ifndef DISPLAY_DRIVER
 #define DISPLAY_DRIVER DISPLAY_DRIVER_SH1106
 #endif //DISPLAY_DRIVER 
 
+// Use fonts reduced to the characters used by the layouts
+#ifndef DISPLAY_FONT_SUBSET
+#define DISPLAY_FONT_SUBSET 0
+#endif //DISPLAY_FONT_SUBSET
+
+// Number of glyphs kept in RAM already decoded and shifted, 0 to disable
+#ifndef DISPLAY_GLYPH_CACHE_SLOTS
+#define DISPLAY_GLYPH_CACHE_SLOTS 0
+#endif //DISPLAY_GLYPH_CACHE_SLOTS
+
+// Maximum glyph size that can be cached, bigger glyphs are always read from font
+#ifndef DISPLAY_GLYPH_CACHE_COLUMNS
+#define DISPLAY_GLYPH_CACHE_COLUMNS 12
+#endif //DISPLAY_GLYPH_CACHE_COLUMNS
+#ifndef DISPLAY_GLYPH_CACHE_PAGES
+#define DISPLAY_GLYPH_CACHE_PAGES 3
+#endif //DISPLAY_GLYPH_CACHE_PAGES
+
+// Size of the read buffer for glyphs of font files
+#ifndef DISPLAY_FONT_FILE_BUFFER
+#define DISPLAY_FONT_FILE_BUFFER 32
+#endif //DISPLAY_FONT_FILE_BUFFER
+
+// Keep drawing in RAM when no panel is connected, for mirroring and screenshots
+#ifndef DISPLAY_VIRTUAL
+#define DISPLAY_VIRTUAL 0
+#endif //DISPLAY_VIRTUAL
+
+// Maximum number of overlays other plugins can add
+#ifndef DISPLAY_OVERLAYS
+#define DISPLAY_OVERLAYS 4
+#endif //DISPLAY_OVERLAYS
+
+// Gray levels in overlays by alternating frames (0 to disable, see display_overlay_set_gray)
+#ifndef DISPLAY_GRAY
+#define DISPLAY_GRAY 0
+#endif //DISPLAY_GRAY
+
+// Frames of a gray cycle: 2 for one gray level (50%), 3 for two gray levels (33% and 67%)
+#ifndef DISPLAY_GRAY_FRAMES
+#define DISPLAY_GRAY_FRAMES 2
+#endif //DISPLAY_GRAY_FRAMES
+
+// Delay between two gray frames in ms
+#ifndef DISPLAY_GRAY_INTERVAL
+#define DISPLAY_GRAY_INTERVAL 10
+#endif //DISPLAY_GRAY_INTERVAL
+
+#if DISPLAY_GRAY && !DISPLAY_OVERLAYS
+#error "DISPLAY_GRAY needs DISPLAY_OVERLAYS"
+#endif //DISPLAY_GRAY && !DISPLAY_OVERLAYS
+
+// Number of strings kept rendered in RAM with their background, 0 to disable
+#ifndef DISPLAY_TEXT_CACHE_ENTRIES
+#define DISPLAY_TEXT_CACHE_ENTRIES 0
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+
+// Canvas size in bytes of each text cache entry (width x pages)
+#ifndef DISPLAY_TEXT_CACHE_BYTES
+#define DISPLAY_TEXT_CACHE_BYTES 160
+#endif //DISPLAY_TEXT_CACHE_BYTES
+
+// Longest string kept in the text cache
+#ifndef DISPLAY_TEXT_CACHE_TEXT
+#define DISPLAY_TEXT_CACHE_TEXT 16
+#endif //DISPLAY_TEXT_CACHE_TEXT
+
+// Stroke font drawn with lines at any height (0 to keep it out of flash)
+#ifndef DISPLAY_STROKE_FONT
+#define DISPLAY_STROKE_FONT 0
+#endif //DISPLAY_STROKE_FONT
+
+// Number of stroke strings kept rendered in RAM (0 to disable the stroke cache)
+#ifndef DISPLAY_STROKE_CACHE_ENTRIES
+#define DISPLAY_STROKE_CACHE_ENTRIES 2
+#endif //DISPLAY_STROKE_CACHE_ENTRIES
+
+// Canvas size in bytes of each stroke cache entry (width x pages)
+#ifndef DISPLAY_STROKE_CACHE_BYTES
+#define DISPLAY_STROKE_CACHE_BYTES 192
+#endif //DISPLAY_STROKE_CACHE_BYTES
+
+// Longest string kept in the stroke cache
+#ifndef DISPLAY_STROKE_CACHE_TEXT
+#define DISPLAY_STROKE_CACHE_TEXT 12
+#endif //DISPLAY_STROKE_CACHE_TEXT
+
 // Include configuration for display type
 #if DISPLAY_DRIVER == DISPLAY_DRIVER_SSD1306
 #include "ssd1306_i2c.h"
@@ -44,6 +195,14 @@
 #include "sh1106_i2c.h"
 #endif //DISPLAY_DRIVER == DISPLAY_DRIVER_SH1106
 
+#if DISPLAY_BOOT_ANIMATION
+#include "./images/boot_animation.h"
+#endif //DISPLAY_BOOT_ANIMATION
+
+#if DISPLAY_STROKE_FONT
+#include "./fonts/stroke.h"
+#endif //DISPLAY_STROKE_FONT
+
 // --------------------------------------------------------
 // Types and Constants
 // --------------------------------------------------------
@@ -56,18 +215,182 @@ typedef struct {
     uint8_t height;         // Character height
     uint16_t char_count;    // Number of characters in font (16-bit value)
     uint8_t spacing;        // Recommended character spacing
+    uint8_t flags;          // Font format flags (FONT_FLAG_*)
+    uint8_t first_code;     // First character code of the direct index
+    uint8_t last_code;      // Last character code of the direct index
+    uint16_t jump_table_offset; // Offset of the jump table
+    uint16_t huffman_offset;    // Offset of the Huffman table (compressed fonts)
+    uint16_t data_offset;       // Offset of the bitmap data
 } font_info_t;
 
 /**
  * Character information structure
  */
 typedef struct {
-    uint16_t bitmap_offset; // Offset to bitmap data
+    uint16_t bitmap_offset; // Offset to bitmap data (first column byte)
     uint8_t width;          // Character width
     uint8_t bytes;          // Size in bytes
+    uint8_t x_offset;       // Columns skipped before the first inked column
+    uint8_t y_offset;       // Rows skipped above the first inked row
+    uint8_t bytes_per_column; // Bytes stored for each column
+    uint8_t columns;        // Number of stored columns
     bool is_defined;        // Whether character is defined in font
 } char_info_t;
 
+/**
+ * Streaming decoder state for glyph bitmaps (compressed or not)
+ */
+typedef struct {
+    const char* font;       // Font data
+    bool compressed;        // Whether bitmap is a Huffman bitstream
+    uint16_t huffman_offset; // Offset of the Huffman table
+    uint16_t position;      // Offset of the next bitstream byte
+    uint8_t current;        // Bitstream byte being decoded
+    uint8_t bit_mask;       // Next bit to read in current byte, 0 if a new byte is needed
+#if DISPLAY_FONT_FILES
+    vfs_file_t* file;       // Font file holding the glyph data, NULL if font is in memory
+    uint16_t buffer_start;  // Font offset of the first buffered byte
+    uint8_t buffer_length;  // Number of buffered bytes
+    uint8_t buffer[DISPLAY_FONT_FILE_BUFFER]; // Glyph data read from file
+#endif //DISPLAY_FONT_FILES
+} glyph_decoder_t;
+
+/**
+ * Animation player state
+ */
+typedef struct {
+    const uint8_t* animation; // Animation data, NULL if no animation is playing
+    uint16_t position;      // Offset of the next frame
+    uint8_t frame;          // Next frame number
+    uint8_t repeat;         // Number of times left to play the animation
+    int16_t x;              // Column of the animation left side
+    uint8_t page;           // Page of the animation top
+} animation_player_t;
+
+#if DISPLAY_IMAGE_FILES
+/**
+ * Buffered sequential reader of image files
+ */
+typedef struct {
+    vfs_file_t* file;       // Open image file
+    uint8_t length;         // Number of buffered bytes
+    uint8_t position;       // Next buffered byte to read
+    uint8_t buffer[DISPLAY_IMAGE_FILE_BUFFER]; // Bytes read from file
+} image_reader_t;
+#endif //DISPLAY_IMAGE_FILES
+
+#if DISPLAY_FONT_FILES
+/**
+ * Font loaded from file: header and index sections are kept in RAM and used
+ * as font data, glyph data stays in the file
+ */
+typedef struct {
+    char* index;            // Header and index sections, NULL if slot is unused
+    uint8_t* glyph_headers; // Glyph headers of each character, NULL if font has none
+    vfs_file_t* file;       // Open font file
+} font_file_t;
+#endif //DISPLAY_FONT_FILES
+
+#if DISPLAY_GLYPH_CACHE_SLOTS
+/**
+ * Glyph cache slot: glyph columns already decoded and shifted to a y phase,
+ * stored page by page so they can be copied to the back buffer without shifting
+ */
+typedef struct {
+    const char* font;       // Font of the glyph, NULL if slot is free
+    uint16_t bitmap_offset; // Glyph bitmap offset, identifies the glyph in the font
+    uint8_t phase;          // Y position modulo 8 of the glyph top
+    uint8_t columns;        // Number of columns
+    uint8_t pages;          // Number of pages per column
+    uint16_t last_used;     // Use stamp for LRU eviction
+    uint8_t data[DISPLAY_GLYPH_CACHE_COLUMNS * DISPLAY_GLYPH_CACHE_PAGES]; // Column bytes, page by page
+} glyph_cache_slot_t;
+#endif //DISPLAY_GLYPH_CACHE_SLOTS
+
+#if DISPLAY_TEXT_ROWS
+/**
+ * Glyph of a text row: columns decoded and shifted to the row phase, stored
+ * page by page so they are written to the back buffer without shifting
+ */
+typedef struct {
+    uint16_t data;          // Offset of the column bytes in the row data
+    uint8_t width;          // Character width
+    uint8_t x_offset;       // Columns skipped before the first inked column
+    uint8_t page;           // Page of the first byte, from the page of the row top
+    uint8_t columns;        // Number of stored columns, 0 if nothing is drawn
+    uint8_t pages;          // Number of pages per column
+} text_row_glyph_t;
+
+/**
+ * Text row: the glyphs of the characters declared for a font and a y phase,
+ * indexed by character code
+ */
+typedef struct {
+    const char* font;       // Font of the row, NULL if free
+    uint8_t phase;          // Y position modulo 8 of the row top
+    uint8_t first_code;     // Character code of the first index entry
+    uint16_t codes;         // Number of index entries
+    text_row_glyph_t* glyphs; // Glyphs, in one allocation with the index and data
+    uint8_t* index;         // Glyph number + 1 of each code, 0 if not declared
+    uint8_t* data;          // Column bytes of the glyphs
+} text_row_t;
+#endif //DISPLAY_TEXT_ROWS
+
+#if DISPLAY_OVERLAYS
+/**
+ * Overlay: screen region of another plugin, drawn in its own canvas and
+ * composed over the back buffer when the display is refreshed
+ */
+struct display_overlay {
+    int16_t x;              // Left column of the region
+    int16_t y;              // Top row of the region
+    uint8_t priority;       // Higher priority overlays are composed over lower ones
+    bool visible;           // Composed in the frames
+    display_canvas_t canvas; // Region content, NULL buffer if slot is unused
+#if DISPLAY_GRAY
+    display_canvas_t gray;  // Low bit of the gray level, NULL buffer if the overlay has no gray levels
+#endif //DISPLAY_GRAY
+};
+#endif //DISPLAY_OVERLAYS
+
+// Operations of display_rect_pages
+typedef enum {
+    RECT_CLEAR = 0,
+    RECT_SET,
+    RECT_INVERT
+} rect_op_t;
+
+#if DISPLAY_TEXT_CACHE_ENTRIES
+/**
+ * Text cache entry: a string already drawn in a canvas with its background, as
+ * display_draw_string() draws it, copied to the back buffer on the next draws
+ */
+typedef struct {
+    uint32_t hash;          // Hash of the string, to compare entries quickly
+    const char* font;       // Font of the string, NULL if entry is free
+    uint8_t color;          // Color of the string, display_color_t
+    int16_t advance;        // Width returned by display_draw_string()
+    uint16_t last_used;     // Use stamp for LRU eviction
+    char text[DISPLAY_TEXT_CACHE_TEXT + 1]; // Rendered string
+    display_canvas_t canvas; // Canvas of the string and its background, using data
+    uint8_t data[DISPLAY_TEXT_CACHE_BYTES]; // Canvas bytes
+} text_cache_entry_t;
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+
+#if DISPLAY_STROKE_FONT && DISPLAY_STROKE_CACHE_ENTRIES
+/**
+ * Stroke cache entry: a stroke string already drawn in a canvas,
+ * copied to the back buffer instead of drawing its lines again
+ */
+typedef struct {
+    char text[DISPLAY_STROKE_CACHE_TEXT + 1]; // Rendered string, empty if entry is free
+    uint8_t height;         // Rendered height
+    uint16_t last_used;     // Use stamp for LRU eviction
+    display_canvas_t canvas; // Canvas of the rendered string, using data
+    uint8_t data[DISPLAY_STROKE_CACHE_BYTES]; // Canvas bytes
+} stroke_cache_entry_t;
+#endif //DISPLAY_STROKE_FONT && DISPLAY_STROKE_CACHE_ENTRIES
+
 // Define data to display
 typedef struct {
     const char *state;
@@ -90,20 +413,99 @@ static const uint8_t JUMPTABLE_LSB_OFFSET = 1;     // Offset for LSB in jump tab
 static const uint8_t JUMPTABLE_SIZE_OFFSET = 2;    // Offset for size in jump table
 static const uint8_t JUMPTABLE_WIDTH_OFFSET = 3;   // Offset for width in jump table
 
+// Font format flags, stored in the upper bits of the char count MSB
+static const uint8_t FONT_FLAG_CROPPED = 0x80;     // Glyphs are cropped to their ink bounding box
+static const uint8_t FONT_FLAG_COMPRESSED = 0x40;  // Glyphs are Huffman compressed
+static const uint8_t FONT_FLAG_DIRECT_INDEX = 0x20; // Character table is a lookup table indexed by character code
+static const uint8_t FONT_COUNT_MSB_MASK = 0x1F;   // Remaining bits of the char count MSB
+
+// Cropped glyph header: x offset, y offset, bytes per column
+static const uint8_t GLYPH_HEADER_SIZE = 3;
+// Compressed glyph header: decoded size in bytes
+static const uint8_t GLYPH_COMPRESSED_HEADER_SIZE = 1;
+// Size of both glyph headers
+#define GLYPH_HEADERS_MAX_SIZE 4
+
+// Animation header: width, height, frame count, frame delay in 10 ms units
+static const uint8_t ANIMATION_HEADER_SIZE = 4;
+// Animation delta span header: page, column, length
+static const uint8_t ANIMATION_SPAN_HEADER_SIZE = 3;
+
+// Icon sheet: icon count, then index entries of offset MSB, offset LSB, width, pages
+static const uint8_t ICON_SHEET_HEADER_SIZE = 1;
+static const uint8_t ICON_INDEX_ENTRY_SIZE = 4;
+
+#if DISPLAY_STROKE_FONT
+// Stroke font header: grid height, char count, then char codes and jump table
+static const uint8_t STROKE_HEADER_SIZE = 2;
+// Stroke jump table entry: offset MSB, offset LSB, width in grid units
+static const uint8_t STROKE_JUMPTABLE_BYTES_PER_CHAR = 3;
+// Stroke data markers, other bytes are points (x << 4) | y
+static const uint8_t STROKE_PEN_UP = 0xFF;         // Next point starts a new polyline
+static const uint8_t STROKE_GLYPH_END = 0xFE;      // End of the glyph strokes
+#endif //DISPLAY_STROKE_FONT
+
 static bool disp_connected = false;
+static bool disp_virtual = false;  // No panel, only the RAM buffers are used
 static i2c_transfer_t i2c_data = {
    .cmd_bytes = 1,
    .no_block = On
 };
+static display_transfer_ptr transfer_handler = NULL;
+static uint8_t staging_buffer[DISPLAY_STAGING_SIZE];
 
 // Global variables
+static display_stats_t display_stats = {0};
+#if DISPLAY_GLYPH_CACHE_SLOTS
+static glyph_cache_slot_t glyph_cache[DISPLAY_GLYPH_CACHE_SLOTS];
+static uint16_t glyph_cache_stamp = 0;
+#endif //DISPLAY_GLYPH_CACHE_SLOTS
+#if DISPLAY_TEXT_ROWS
+static text_row_t text_rows[DISPLAY_TEXT_ROWS];
+#endif //DISPLAY_TEXT_ROWS
+#if DISPLAY_FONT_FILES
+static font_file_t font_files[DISPLAY_FONT_BIG + 1]; // One for each font size
+#endif //DISPLAY_FONT_FILES
+static animation_player_t animation_player = {0};
+static display_refresh_listener_ptr refresh_listener = NULL;
+#if DISPLAY_OVERLAYS
+static display_overlay_t overlays[DISPLAY_OVERLAYS];
+static display_overlay_t* overlay_order[DISPLAY_OVERLAYS]; // Used overlays, lowest priority first
+static uint8_t overlay_count = 0;
+static uint8_t* overlay_page = NULL;  // Page of the back buffer with the overlays composed
+static bool overlay_refresh_pending = false;
+#endif //DISPLAY_OVERLAYS
+#if DISPLAY_GRAY
+static uint8_t gray_phase = 0;        // Frame of the gray cycle being shown
+static bool gray_running = false;     // The gray task is scheduled
+#endif //DISPLAY_GRAY
+static uint8_t bus_hold = 0;               // Holds of the bus by other devices, refreshes wait while not 0
+static bool refresh_deferred = false;      // A refresh has changes left to send
+static bool refresh_pending = false;       // The refresh task is scheduled
+static bool refresh_unfinished = false;    // Spans were sent by a deferred refresh, the end of refresh is still to signal
+static uint16_t refresh_budget_max = DISPLAY_REFRESH_BUDGET; // Bytes sent by a refresh at full rate, 0 for no limit
+static uint16_t refresh_budget = DISPLAY_REFRESH_BUDGET;     // Bytes sent by a refresh at the current throttle level
+static uint8_t display_contrast = DISPLAY_CONTRAST;          // Contrast when the display is on
+static bool display_flipped = false;                         // Display rotated by 180 degrees
+static uint8_t throttle_frame = 0;         // Frames counted at the current throttle level
+static display_power_t display_power = DISPLAY_POWER_ON;
+static display_canvas_t canvas_saved = {0}; // Display surface while drawing in a canvas
+static bool canvas_active = false;
+#if DISPLAY_STROKE_FONT && DISPLAY_STROKE_CACHE_ENTRIES
+static stroke_cache_entry_t stroke_cache[DISPLAY_STROKE_CACHE_ENTRIES];
+static uint16_t stroke_cache_stamp = 0;
+#endif //DISPLAY_STROKE_FONT && DISPLAY_STROKE_CACHE_ENTRIES
+#if DISPLAY_TEXT_CACHE_ENTRIES
+static text_cache_entry_t text_cache[DISPLAY_TEXT_CACHE_ENTRIES];
+static uint16_t text_cache_stamp = 0;
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
 static const char* current_font = NULL;
 static display_color_t current_fg_color = DISPLAY_COLOR_WHITE;
 static display_color_t current_bg_color = DISPLAY_COLOR_BLACK;
 
 
 // Macro
-#ifndef ARDUINO
+#if !defined(ARDUINO) && !defined(pgm_read_byte)
 #define pgm_read_byte(ptr) (*(ptr))
 #endif
 
@@ -112,12 +514,76 @@ static display_color_t current_bg_color = DISPLAY_COLOR_BLACK;
 // --------------------------------------------------------
 // Interface functions
 
+static bool display_transfer(const display_transfer_t* transfer);
 static bool display_send_command(uint8_t command);
-static bool display_send_data(uint8_t * command, size_t size);
+static bool display_send_data(const uint8_t * data, size_t size);
+static bool display_send_at(uint8_t page, uint8_t column, const uint8_t* data, size_t size);
 
 // Helper functions
 font_info_t get_font_info(const char* font);
 char_info_t get_char_info(const char* font, char c);
+static char_info_t get_char_info_with_font_info(const char* font, const font_info_t* font_info, char c);
+static void display_blit_byte(int16_t x, int16_t y, uint8_t bits);
+static int16_t display_draw_glyph(int16_t x, int16_t y, const char* font, const font_info_t* font_info, const char_info_t* char_info);
+static int16_t find_char_index(const char* font, const font_info_t* font_info, char c);
+static void glyph_decoder_init(glyph_decoder_t* decoder, const char* font, const font_info_t* font_info, uint16_t position);
+static uint8_t glyph_decoder_next(glyph_decoder_t* decoder);
+#if DISPLAY_GLYPH_CACHE_SLOTS
+static glyph_cache_slot_t* glyph_cache_get(const char* font, const font_info_t* font_info, const char_info_t* char_info, uint8_t phase);
+#endif //DISPLAY_GLYPH_CACHE_SLOTS
+#if DISPLAY_TEXT_ROWS
+static const text_row_t* text_row_find(const char* font, int16_t y);
+static const text_row_glyph_t* text_row_glyph(const text_row_t* row, char c);
+static void text_row_draw(const text_row_t* row, const text_row_glyph_t* glyph, int16_t x, int16_t y);
+#if DISPLAY_FONT_FILES
+static void text_row_forget(const char* font);
+#endif //DISPLAY_FONT_FILES
+#endif //DISPLAY_TEXT_ROWS
+static const char* get_font_by_size(display_font_size_t font_size);
+static void get_glyph_header(const char* font, int16_t char_index, uint16_t bitmap_offset, uint8_t length, uint8_t* header);
+#if DISPLAY_IMAGE_FILES
+static bool image_reader_next(image_reader_t* reader, uint8_t* byte);
+#endif //DISPLAY_IMAGE_FILES
+static void animation_task(void* data);
+static const uint8_t* display_compose_page(uint8_t page);
+#if DISPLAY_OVERLAYS
+static void overlay_refresh_task(void* data);
+#endif //DISPLAY_OVERLAYS
+#if DISPLAY_GRAY
+static void gray_start(void);
+static void gray_task(void* data);
+#endif //DISPLAY_GRAY
+static void refresh_task(void* data);
+static void display_defer_refresh(void);
+#if DISPLAY_FONT_FILES
+static font_file_t* get_font_file(const char* font);
+static uint8_t glyph_decoder_read(glyph_decoder_t* decoder);
+#else
+// Glyph data is always in memory
+#define glyph_decoder_read(decoder) pgm_read_byte(&(decoder)->font[(decoder)->position++])
+#endif //DISPLAY_FONT_FILES
+#if DISPLAY_GLYPH_CACHE_SLOTS && DISPLAY_FONT_FILES
+static void glyph_cache_forget(const char* font);
+#endif //DISPLAY_GLYPH_CACHE_SLOTS && DISPLAY_FONT_FILES
+static void display_rect_pages(int16_t x, int16_t y, int16_t width, int16_t height, rect_op_t op);
+static int16_t display_draw_string_box(int16_t x, int16_t y, const char* text, uint16_t text_width);
+#if DISPLAY_TEXT_CACHE_ENTRIES
+static bool text_cache_hash(const char* text, uint32_t* hash);
+static text_cache_entry_t* text_cache_find(const char* text);
+static text_cache_entry_t* text_cache_get(int16_t x, const char* text);
+#if DISPLAY_FONT_FILES
+static void text_cache_forget(const char* font);
+#endif //DISPLAY_FONT_FILES
+static void display_copy_canvas(int16_t x, int16_t y, const display_canvas_t* canvas);
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+#if DISPLAY_STROKE_FONT
+static int16_t find_stroke_char(char c);
+static uint8_t get_stroke_char_width(int16_t index, uint8_t height);
+static int16_t display_draw_stroke_char(int16_t x, int16_t y, char c, uint8_t height);
+#if DISPLAY_STROKE_CACHE_ENTRIES
+static stroke_cache_entry_t* stroke_cache_get(const char* text, uint8_t height);
+#endif //DISPLAY_STROKE_CACHE_ENTRIES
+#endif //DISPLAY_STROKE_FONT
 bool display_draw_pixel_safe(int16_t x, int16_t y);
 uint8_t utf8_to_ascii(unsigned char c);
 char* utf8_string_to_ascii(const char* str);
@@ -128,22 +594,112 @@ char* utf8_string_to_ascii(const char* str);
 // Helper Functions
 // --------------------------------------------------------
 
-static bool display_send_command(uint8_t command) {
-    // Prepare the data transfer structure
-    // with a command head of display_config.command_head
-    i2c_data.count = 1;
-    i2c_data.data = &command;
-    i2c_data.cmd = display_config.command_head;
+/**
+ * Send a transfer to the display, as a single I2C transaction
+ * The transfer handler sends it directly from the segments, otherwise a single segment
+ * is sent after the control byte by the HAL and several segments are copied in the staging buffer
+ */
+static bool display_transfer(const display_transfer_t* transfer) {
+    // Nothing to send to a virtual display
+    if (disp_virtual) {
+        return true;
+    }
+    display_stats.i2c_transactions++;
+    if (transfer_handler) {
+        return transfer_handler(transfer);
+    }
+    
+    i2c_data.cmd = transfer->control;
+    if (transfer->count == 1) {
+        i2c_data.data = (uint8_t*)transfer->segments[0].data;
+        i2c_data.count = transfer->segments[0].length;
+    } else {
+        uint16_t size = 0;
+        for (uint8_t i = 0; i < transfer->count; i++) {
+            if (size + transfer->segments[i].length > sizeof(staging_buffer)) {
+                return false;
+            }
+            memcpy(staging_buffer + size, transfer->segments[i].data, transfer->segments[i].length);
+            size += transfer->segments[i].length;
+        }
+        display_stats.i2c_staged_bytes += size;
+        i2c_data.data = staging_buffer;
+        i2c_data.count = size;
+    }
     return i2c_transfer(&i2c_data, false);
 }
 
-static bool display_send_data(  uint8_t* data, size_t size) {
-    // Prepare the data transfer structure
-    // with a data head of display_config.data_head 
-    i2c_data.count = size;
-    i2c_data.data = data;
-    i2c_data.cmd = display_config.data_head;
-    return i2c_transfer(&i2c_data, false);
+static bool display_send_command(uint8_t command) {
+    // Prepare the transfer with a command head of display_config.command_head
+    display_transfer_t transfer = {
+        .address = display_config.i2c_address,
+        .control = display_config.command_head,
+        .count = 1,
+        .segments = {{ &command, 1 }}
+    };
+    return display_transfer(&transfer);
+}
+
+static bool display_send_data(const uint8_t* data, size_t size) {
+    bool success = true;
+    // Send the data in transactions of DISPLAY_I2C_CHUNK bytes at most,
+    // each one with a data head of display_config.data_head, the display
+    // keeps its column address between them and other devices can use
+    // the bus in between
+    while (size > 0) {
+        size_t count = size;
+#if DISPLAY_I2C_CHUNK
+        if (count > DISPLAY_I2C_CHUNK) {
+            count = DISPLAY_I2C_CHUNK;
+        }
+#endif //DISPLAY_I2C_CHUNK
+        display_transfer_t transfer = {
+            .address = display_config.i2c_address,
+            .control = display_config.data_head,
+            .count = 1,
+            .segments = {{ data, count }}
+        };
+        if (!disp_virtual) {
+            display_stats.i2c_data_bytes += count;
+        }
+        success &= display_transfer(&transfer);
+        data += count;
+        size -= count;
+    }
+    return success;
+}
+
+/**
+ * Send data to a page of the display from a column
+ * The page and column commands are sent in the same transaction as the first data bytes,
+ * each command after a command head and the data after a data head
+ */
+static bool display_send_at(uint8_t page, uint8_t column, const uint8_t* data, size_t size) {
+    uint8_t prefix[SPAN_PREFIX_SIZE] = {
+        0xB0 | page,                                   // Set the page
+        display_config.command_head,
+        0x00 | ((column + display_config.column_offset) & 0x0F),      // Set lower column start address
+        display_config.command_head,
+        0x10 | (((column + display_config.column_offset) >> 4) & 0x0F), // Set higher column start address
+        display_config.data_head
+    };
+    size_t count = size;
+    if (count > DISPLAY_STAGING_SIZE - SPAN_PREFIX_SIZE) {
+        count = DISPLAY_STAGING_SIZE - SPAN_PREFIX_SIZE;
+    }
+    display_transfer_t transfer = {
+        .address = display_config.i2c_address,
+        .control = display_config.command_head,
+        .count = 2,
+        .segments = {{ prefix, SPAN_PREFIX_SIZE }, { data, count }}
+    };
+    if (!disp_virtual) {
+        display_stats.i2c_data_bytes += count;
+    }
+    bool success = display_transfer(&transfer);
+    
+    // Send the rest of the data
+    return display_send_data(data + count, size - count) && success;
 }
 
 /**
@@ -156,9 +712,34 @@ font_info_t get_font_info(const char* font) {
     
     info.width = pgm_read_byte(&font[0]);
     info.height = pgm_read_byte(&font[1]);
-    info.char_count = (pgm_read_byte(&font[2]) << 8) | pgm_read_byte(&font[3]);
+    info.flags = pgm_read_byte(&font[2]) & ~FONT_COUNT_MSB_MASK;
+    info.char_count = ((pgm_read_byte(&font[2]) & FONT_COUNT_MSB_MASK) << 8) | pgm_read_byte(&font[3]);
     info.spacing = pgm_read_byte(&font[4]);
     
+    // Sections offsets
+    if (info.flags & FONT_FLAG_DIRECT_INDEX) {
+        // Direct index: first code, last code, then the index of each code
+        info.first_code = pgm_read_byte(&font[FONT_HEADER_SIZE]);
+        info.last_code = pgm_read_byte(&font[FONT_HEADER_SIZE + 1]);
+        info.jump_table_offset = FONT_HEADER_SIZE + 2 + (info.last_code - info.first_code + 1);
+    } else {
+        info.jump_table_offset = FONT_HEADER_SIZE + info.char_count;
+    }
+    info.data_offset = info.jump_table_offset + (info.char_count * JUMPTABLE_BYTES_PER_CHAR);
+    
+    // Compressed fonts have the Huffman table between the jump table and the bitmap data:
+    // max code length, count of codes for each length, symbols
+    if (info.flags & FONT_FLAG_COMPRESSED) {
+        uint8_t max_length = pgm_read_byte(&font[info.data_offset]);
+        uint16_t symbols = 0;
+        
+        info.huffman_offset = info.data_offset;
+        for (uint8_t i = 1; i <= max_length; i++) {
+            symbols += pgm_read_byte(&font[info.huffman_offset + i]);
+        }
+        info.data_offset += 1 + max_length + symbols;
+    }
+    
     return info;
 }
 
@@ -170,13 +751,30 @@ int16_t find_char_in_table(const char* font, char c) {
     if (font == NULL) return -1;
     
     font_info_t font_info = get_font_info(font);
+    
+    return find_char_index(font, &font_info, c);
+}
+
+/**
+ * Find a character in the character table, reusing already decoded font information
+ */
+static int16_t find_char_index(const char* font, const font_info_t* font_info, char c) {
     uint8_t char_code = (uint8_t)c;
     
+    // Direct index fonts give the index without searching
+    if (font_info->flags & FONT_FLAG_DIRECT_INDEX) {
+        if (char_code < font_info->first_code || char_code > font_info->last_code) {
+            return -1;
+        }
+        uint8_t index = pgm_read_byte(&font[FONT_HEADER_SIZE + 2 + (char_code - font_info->first_code)]);
+        return index == 0xFF ? -1 : index;
+    }
+    
     // Character table starts after the header
     uint16_t char_table_offset = FONT_HEADER_SIZE;
     
     // Search for the character in the table
-    for (uint16_t i = 0; i < font_info.char_count; i++) {
+    for (uint16_t i = 0; i < font_info->char_count; i++) {
         uint8_t table_char = pgm_read_byte(&font[char_table_offset + i]);
         if (table_char == char_code) {
             return i; // Found the character
@@ -190,15 +788,48 @@ int16_t find_char_in_table(const char* font, char c) {
  * Get character information from font
  */
 char_info_t get_char_info(const char* font, char c) {
+    if (font == NULL) {
+        char_info_t info = {0};
+        return info;
+    }
+
+    font_info_t font_info = get_font_info(font);
+
+    return get_char_info_with_font_info(font, &font_info, c);
+}
+
+/**
+ * Read the headers at the start of a glyph data
+ * Font files keep them in RAM so getting character information needs no file access
+ */
+static void get_glyph_header(const char* font, int16_t char_index, uint16_t bitmap_offset, uint8_t length, uint8_t* header) {
+#if DISPLAY_FONT_FILES
+    font_file_t* font_file = get_font_file(font);
+    if (font_file) {
+        if (font_file->glyph_headers) {
+            memcpy(header, &font_file->glyph_headers[char_index * GLYPH_HEADERS_MAX_SIZE], length);
+        }
+        return;
+    }
+#else
+    (void)char_index;
+#endif //DISPLAY_FONT_FILES
+    for (uint8_t i = 0; i < length; i++) {
+        header[i] = pgm_read_byte(&font[bitmap_offset + i]);
+    }
+}
+
+/**
+ * Get character information from font, reusing already decoded font information
+ */
+static char_info_t get_char_info_with_font_info(const char* font, const font_info_t* font_info_ptr, char c) {
     char_info_t info = {0};
     info.is_defined = false;
     
-    if (font == NULL) return info;
-    
-    font_info_t font_info = get_font_info(font);
+    font_info_t font_info = *font_info_ptr;
     
     // Find the character in the character table
-    int16_t char_index = find_char_in_table(font, c);
+    int16_t char_index = find_char_index(font, &font_info, c);
     
     // Check if character was found
     if (char_index < 0) {
@@ -207,7 +838,7 @@ char_info_t get_char_info(const char* font, char c) {
     }
     
     // Calculate jump table entry position
-    uint16_t jump_table_offset = FONT_HEADER_SIZE + font_info.char_count + (char_index * JUMPTABLE_BYTES_PER_CHAR);
+    uint16_t jump_table_offset = font_info.jump_table_offset + (char_index * JUMPTABLE_BYTES_PER_CHAR);
     
     // Read jump table entry
     uint8_t offset_msb = pgm_read_byte(&font[jump_table_offset + JUMPTABLE_MSB_OFFSET]);
@@ -224,7 +855,53 @@ char_info_t get_char_info(const char* font, char c) {
     
     // Calculate bitmap offset
     uint16_t offset = (offset_msb << 8) | offset_lsb;
-    info.bitmap_offset = FONT_HEADER_SIZE + font_info.char_count + (font_info.char_count * JUMPTABLE_BYTES_PER_CHAR) + offset;
+    info.bitmap_offset = font_info.data_offset + offset;
+    
+    // Read the glyph headers
+    uint8_t glyph_header[GLYPH_HEADERS_MAX_SIZE];
+    uint8_t header_length = 0;
+    if (font_info.flags & FONT_FLAG_CROPPED) {
+        header_length += GLYPH_HEADER_SIZE;
+    }
+    if (font_info.flags & FONT_FLAG_COMPRESSED) {
+        header_length += GLYPH_COMPRESSED_HEADER_SIZE;
+    }
+    if (header_length > info.bytes) {
+        header_length = info.bytes;
+    }
+    get_glyph_header(font, char_index, info.bitmap_offset, header_length, glyph_header);
+    uint8_t* header = glyph_header;
+    
+    if (font_info.flags & FONT_FLAG_CROPPED) {
+        // Cropped glyphs start with their own header: x offset, y offset, bytes per column
+        if (info.bytes <= GLYPH_HEADER_SIZE) {
+            info.bytes = 0;
+            return info;
+        }
+        info.x_offset = *header++;
+        info.y_offset = *header++;
+        info.bytes_per_column = *header++;
+        info.bitmap_offset += GLYPH_HEADER_SIZE;
+        info.bytes -= GLYPH_HEADER_SIZE;
+    } else {
+        info.bytes_per_column = (font_info.height + 7) / 8;
+    }
+    
+    if (font_info.flags & FONT_FLAG_COMPRESSED) {
+        // Compressed glyphs give their decoded size, then the bitstream
+        if (info.bytes <= GLYPH_COMPRESSED_HEADER_SIZE) {
+            info.bytes = 0;
+            return info;
+        }
+        info.bytes = *header;
+        info.bitmap_offset += GLYPH_COMPRESSED_HEADER_SIZE;
+    }
+    
+    if (info.bytes_per_column == 0) {
+        info.bytes = 0;
+        return info;
+    }
+    info.columns = info.bytes / info.bytes_per_column;
     
     return info;
 }
@@ -341,23 +1018,187 @@ void display_set_pixel(int16_t x, int16_t y) {
 }
 
 /**
- * Set the current font by size
+ * Draw 8 vertical pixels starting at given position, bit 0 being the top pixel
+ * The byte is split over the 2 pages it overlaps
  */
-void display_set_font(display_font_size_t font_size) {
+static void display_blit_byte(int16_t x, int16_t y, uint8_t bits) {
+    // Check if anything is visible
+    if (bits == 0 || x < 0 || x >= display_config.width || y <= -BITS_PER_BYTE || y >= display_config.height) {
+        return;
+    }
+
+    // Page and bit position of the top pixel, page is -1 if the top is above the screen
+    int16_t page = y >= 0 ? y / BITS_PER_BYTE : -1;
+    uint8_t shift = y - (page * BITS_PER_BYTE);
+    uint8_t *column = &display_config.back_buffer[x];
+
+    // Upper page part
+    if (page >= 0) {
+        uint8_t mask = bits << shift;
+        if (current_fg_color == DISPLAY_COLOR_WHITE) {
+            column[page * display_config.width] |= mask;
+        } else {
+            column[page * display_config.width] &= ~mask;
+        }
+    }
+
+    // Lower page part
+    if (shift != 0 && page + 1 < display_config.pages) {
+        uint8_t mask = bits >> (BITS_PER_BYTE - shift);
+        if (current_fg_color == DISPLAY_COLOR_WHITE) {
+            column[(page + 1) * display_config.width] |= mask;
+        } else {
+            column[(page + 1) * display_config.width] &= ~mask;
+        }
+    }
+}
+
+/**
+ * Get the font configured for a size
+ */
+static const char* get_font_by_size(display_font_size_t font_size) {
+    switch (font_size) {
+        case DISPLAY_FONT_MEDIUM:
+            return display_config.display_medium_font;
+        case DISPLAY_FONT_BIG:
+            return display_config.display_big_font;
+        case DISPLAY_FONT_SMALL:
+        default:
+            return display_config.display_small_font;  // Default to small font
+    }
+}
+
+/**
+ * Load the font of a size from a file in the font binary format (the bytes of
+ * the font headers), replacing the current one
+ * Only header and index sections are loaded in RAM, glyphs are read when drawn
+ */
+bool display_load_font(display_font_size_t font_size, const char* path) {
+#if DISPLAY_FONT_FILES
+    if (font_size > DISPLAY_FONT_BIG || path == NULL) {
+        return false;
+    }
+    
+    vfs_file_t* file = vfs_open(path, "r");
+    if (file == NULL) {
+        return false;
+    }
+    
+    // Get the index size from the header: header and direct index range are enough
+    // to locate the jump table, compressed fonts also need the Huffman table counts
+    uint8_t header[7]; // Font header and direct index range
+    memset(header, 0, sizeof(header));
+    if (vfs_read(header, 1, sizeof(header), file) < FONT_HEADER_SIZE) {
+        vfs_close(file);
+        return false;
+    }
+    uint8_t flags = header[2];
+    header[2] &= ~FONT_FLAG_COMPRESSED;
+    uint16_t index_size = get_font_info((const char*)header).data_offset;
+    header[2] = flags;
+    
+    if (flags & FONT_FLAG_COMPRESSED) {
+        uint8_t counts[1 + 16];
+        uint16_t symbols = 0;
+        if (vfs_seek(file, index_size) != 0 || vfs_read(counts, 1, 1, file) != 1 || counts[0] > 16 ||
+            vfs_read(&counts[1], 1, counts[0], file) != counts[0]) {
+            vfs_close(file);
+            return false;
+        }
+        for (uint8_t i = 1; i <= counts[0]; i++) {
+            symbols += counts[i];
+        }
+        index_size += 1 + counts[0] + symbols;
+    }
+    
+    // Load header and index sections
+    char* index = (char*)malloc(index_size);
+    if (index == NULL || vfs_seek(file, 0) != 0 || vfs_read(index, 1, index_size, file) != index_size) {
+        free(index);
+        vfs_close(file);
+        return false;
+    }
+    
+    // Load the glyph headers, so only glyph bitmaps are read when drawing
+    font_info_t font_info = get_font_info(index);
+    uint8_t* glyph_headers = NULL;
+    if (font_info.flags & (FONT_FLAG_CROPPED | FONT_FLAG_COMPRESSED)) {
+        glyph_headers = (uint8_t*)calloc(font_info.char_count, GLYPH_HEADERS_MAX_SIZE);
+        if (glyph_headers == NULL) {
+            free(index);
+            vfs_close(file);
+            return false;
+        }
+        for (uint16_t i = 0; i < font_info.char_count; i++) {
+            uint16_t entry = font_info.jump_table_offset + (i * JUMPTABLE_BYTES_PER_CHAR);
+            uint8_t offset_msb = index[entry + JUMPTABLE_MSB_OFFSET];
+            uint8_t offset_lsb = index[entry + JUMPTABLE_LSB_OFFSET];
+            uint8_t bytes = index[entry + JUMPTABLE_SIZE_OFFSET];
+            if ((offset_msb == 0xFF && offset_lsb == 0xFF) || bytes == 0) {
+                continue;
+            }
+            if (bytes > GLYPH_HEADERS_MAX_SIZE) {
+                bytes = GLYPH_HEADERS_MAX_SIZE;
+            }
+            if (vfs_seek(file, font_info.data_offset + ((offset_msb << 8) | offset_lsb)) != 0 ||
+                vfs_read(&glyph_headers[i * GLYPH_HEADERS_MAX_SIZE], 1, bytes, file) != bytes) {
+                free(glyph_headers);
+                free(index);
+                vfs_close(file);
+                return false;
+            }
+        }
+    }
+    
+    // Replace the font of this size
+    font_file_t* font_file = &font_files[font_size];
+    const char* previous = get_font_by_size(font_size);
+    if (font_file->index) {
+#if DISPLAY_GLYPH_CACHE_SLOTS
+        glyph_cache_forget(font_file->index);
+#endif //DISPLAY_GLYPH_CACHE_SLOTS
+#if DISPLAY_TEXT_CACHE_ENTRIES
+        text_cache_forget(font_file->index);
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+#if DISPLAY_TEXT_ROWS
+        text_row_forget(font_file->index);
+#endif //DISPLAY_TEXT_ROWS
+        vfs_close(font_file->file);
+        free(font_file->index);
+        free(font_file->glyph_headers);
+    }
+    font_file->index = index;
+    font_file->glyph_headers = glyph_headers;
+    font_file->file = file;
+    
     switch (font_size) {
         case DISPLAY_FONT_SMALL:
-            current_font = display_config.display_small_font;
+            display_config.display_small_font = index;
             break;
         case DISPLAY_FONT_MEDIUM:
-            current_font = display_config.display_medium_font;
+            display_config.display_medium_font = index;
             break;
         case DISPLAY_FONT_BIG:
-            current_font = display_config.display_big_font;
-            break;
-        default:
-            current_font = display_config.display_small_font;  // Default to small font
+            display_config.display_big_font = index;
             break;
     }
+    if (current_font == previous) {
+        current_font = index;
+    }
+    
+    return true;
+#else
+    (void)font_size;
+    (void)path;
+    return false;
+#endif //DISPLAY_FONT_FILES
+}
+
+/**
+ * Set the current font by size
+ */
+void display_set_font(display_font_size_t font_size) {
+    current_font = get_font_by_size(font_size);
 }
 
 /**
@@ -402,10 +1243,26 @@ void display_draw_rect(int16_t x, int16_t y, int16_t width, int16_t height) {
  * Fill a rectangle
  */
 void display_fill_rect(int16_t x, int16_t y, int16_t width, int16_t height) {
+    display_rect_pages(x, y, width, height, current_fg_color == DISPLAY_COLOR_WHITE ? RECT_SET : RECT_CLEAR);
+}
+
+/**
+ * Invert the pixels of a rectangle
+ * Highlights a region (menu row, selection) without drawing it again, inverting it
+ * again removes the highlight
+ */
+void display_invert_rect(int16_t x, int16_t y, int16_t width, int16_t height) {
+    display_rect_pages(x, y, width, height, RECT_INVERT);
+}
+
+/**
+ * Set, clear or invert the pixels of a rectangle, a page at a time
+ */
+static void display_rect_pages(int16_t x, int16_t y, int16_t width, int16_t height, rect_op_t op) {
     // Check boundaries
     if (x >= display_config.width || y >= display_config.height || width <= 0 || height <= 0)
         return;
-    
+
     // Clipping to screen boundaries
     if (x < 0) {
         width += x;
@@ -421,11 +1278,31 @@ void display_fill_rect(int16_t x, int16_t y, int16_t width, int16_t height) {
     if (y + height > display_config.height) {
         height = display_config.height - y;
     }
-    
-    // Fill line by line
-    for (int16_t j = y; j < y + height; j++) {
-        for (int16_t i = x; i < x + width; i++) {
-            display_set_pixel(i, j);
+
+    // Rows of the rectangle in each page
+    uint8_t first_page = y / BITS_PER_BYTE;
+    uint8_t last_page = (y + height - 1) / BITS_PER_BYTE;
+    for (uint8_t page = first_page; page <= last_page; page++) {
+        uint8_t mask = 0xFF;
+        if (page == first_page) {
+            mask &= 0xFF << (y % BITS_PER_BYTE);
+        }
+        if (page == last_page) {
+            mask &= 0xFF >> (BITS_PER_BYTE - 1 - ((y + height - 1) % BITS_PER_BYTE));
+        }
+        uint8_t *column = &display_config.back_buffer[(page * display_config.width) + x];
+        for (int16_t i = 0; i < width; i++) {
+            switch (op) {
+                case RECT_SET:
+                    column[i] |= mask;
+                    break;
+                case RECT_CLEAR:
+                    column[i] &= ~mask;
+                    break;
+                default:
+                    column[i] ^= mask;
+                    break;
+            }
         }
     }
 }
@@ -508,243 +1385,2084 @@ void display_draw_xbm(int16_t x, int16_t y, int16_t width, int16_t height, const
     }
 }
 
-uint16_t get_font_height(){
-    return get_font_info(current_font).height;
+#if DISPLAY_IMAGE_FILES
+// Image file header: width, height, flags
+static const uint8_t IMAGE_HEADER_SIZE = 3;
+// Image file flags
+static const uint8_t IMAGE_FLAG_RLE = 0x01;        // Page data is run length encoded
+
+/**
+ * Read next byte of an image file
+ * Returns false at end of file or on read error
+ */
+static bool image_reader_next(image_reader_t* reader, uint8_t* byte) {
+    if (reader->position >= reader->length) {
+        reader->length = vfs_read(reader->buffer, 1, DISPLAY_IMAGE_FILE_BUFFER, reader->file);
+        reader->position = 0;
+        if (reader->length == 0) {
+            return false;
+        }
+    }
+    *byte = reader->buffer[reader->position++];
+    return true;
 }
+#endif //DISPLAY_IMAGE_FILES
 
 /**
- * Draw a single character with the specified font
+ * Get the size of an image file
  */
-int16_t display_draw_char(int16_t x, int16_t y, char c, const char* font) {
-    if (font == NULL) {
-        return 0;
+bool display_get_image_file_size(const char* path, uint16_t* width, uint16_t* height) {
+#if DISPLAY_IMAGE_FILES
+    uint8_t header[3];
+    vfs_file_t* file = vfs_open(path, "r");
+    
+    if (file == NULL) {
+        return false;
     }
+    bool success = vfs_read(header, 1, IMAGE_HEADER_SIZE, file) == IMAGE_HEADER_SIZE;
+    vfs_close(file);
     
-    // Get font and character information
-    font_info_t font_info = get_font_info(font);
-    char_info_t char_info = get_char_info(font, c);
+    if (success) {
+        *width = header[0];
+        *height = header[1];
+    }
+    return success;
+#else
+    (void)path;
+    (void)width;
+    (void)height;
+    return false;
+#endif //DISPLAY_IMAGE_FILES
+}
 
-    // If character is not defined OR has no bitmap data, just return its width
-    if (!char_info.is_defined || char_info.bytes == 0) {
-        return char_info.width +  font_info.spacing;
+/**
+ * Draw an image file in page-major format (see png_converter.py --binary):
+ * header [width][height][flags], then each page of 8 rows as width bytes, bit 0 on top
+ * RLE data is a sequence of [0x80 | (count - 1)][byte] runs and
+ * [count - 1][count bytes] literals
+ * The file is streamed to the back buffer, only the read buffer is in RAM
+ */
+bool display_draw_image_file(int16_t x, int16_t y, const char* path) {
+#if DISPLAY_IMAGE_FILES
+    image_reader_t reader = {0};
+    uint8_t width, height, flags;
+    
+    if ((reader.file = vfs_open(path, "r")) == NULL) {
+        return false;
     }
     
-    // Calculate bytes per column and number of columns
-    uint8_t bytes_per_column = (font_info.height + 7) / 8;
-    uint8_t data_columns = char_info.bytes / bytes_per_column;
+    if (!image_reader_next(&reader, &width) || !image_reader_next(&reader, &height) || !image_reader_next(&reader, &flags)) {
+        vfs_close(reader.file);
+        return false;
+    }
     
-    // Draw the character pixel by pixel
-    for (uint8_t j = 0; j < data_columns; j++) {
-        // For each vertical byte in this column
-        for (uint8_t k = 0; k < bytes_per_column; k++) {
-            // Get byte from font data
-            uint16_t byte_offset = char_info.bitmap_offset + (j * bytes_per_column) + k;
-            uint8_t column_byte = pgm_read_byte(&font[byte_offset]);
-            
-            if (column_byte == 0) continue; // Skip empty bytes for optimization
-            
-            // Draw each bit of the column byte
-            for (uint8_t bit = 0; bit < BITS_PER_BYTE; bit++) {
-                // Make sure we're not drawing beyond the font height
-                if ((k * BITS_PER_BYTE + bit) >= font_info.height) 
-                    continue;
-                    
-                // Check if this bit is set in the column byte
-                if (column_byte & (1 << bit)) {
-                    // Calculate y position
-                    int16_t y_pixel = y + (k * BITS_PER_BYTE) + bit;
-                    
-                    // Draw pixel if within display bounds
-                    if (y_pixel >= 0 && y_pixel < display_config.height) {
-                        display_set_pixel(x + j, y_pixel);
-                    }
+    uint16_t size = width * ((height + 7) / BITS_PER_BYTE);
+    uint16_t count = 0;      // Bytes left in current run or literal
+    bool run = false;        // Current RLE block is a run
+    uint8_t byte = 0;
+    bool success = true;
+    
+    for (uint16_t i = 0; i < size && success; i++) {
+        if (flags & IMAGE_FLAG_RLE) {
+            if (count == 0) {
+                uint8_t control;
+                success = image_reader_next(&reader, &control);
+                run = (control & 0x80) != 0;
+                count = (control & 0x7F) + 1;
+                if (success && run) {
+                    success = image_reader_next(&reader, &byte);
                 }
             }
+            if (success && !run) {
+                success = image_reader_next(&reader, &byte);
+            }
+            count--;
+        } else {
+            success = image_reader_next(&reader, &byte);
+        }
+        if (success && byte) {
+            display_blit_byte(x + (i % width), y + ((i / width) * BITS_PER_BYTE), byte);
         }
     }
     
-    // Return the width plus spacing
-    return char_info.width + font_info.spacing;
+    vfs_close(reader.file);
+    
+    return success;
+#else
+    (void)x;
+    (void)y;
+    (void)path;
+    return false;
+#endif //DISPLAY_IMAGE_FILES
 }
 
 /**
- * Draw a string with the specified font
+ * Get the width of an icon of a sheet (see icon_converter.py)
  */
-int16_t display_draw_string_with_font(int16_t x, int16_t y, const char* text, const char* font) {
-    if (text == NULL || font == NULL) return 0;
+uint8_t display_get_icon_width(const uint8_t* sheet, uint8_t id) {
+    if (sheet == NULL || id >= pgm_read_byte(&sheet[0])) {
+        return 0;
+    }
+    return pgm_read_byte(&sheet[ICON_SHEET_HEADER_SIZE + (id * ICON_INDEX_ENTRY_SIZE) + 2]);
+}
+
+/**
+ * Draw an icon of a sheet (see icon_converter.py)
+ * At a page aligned y each column is a byte copy, icon background included,
+ * otherwise the icon is drawn over the current content
+ */
+void display_draw_icon(int16_t x, int16_t y, const uint8_t* sheet, uint8_t id) {
+    if (sheet == NULL || id >= pgm_read_byte(&sheet[0])) {
+        return;
+    }
     
-    font_info_t font_info = get_font_info(font);
-    int16_t cursor_x = x;
-    int16_t cursor_y = y;
-    int16_t initial_x = x;
+    uint8_t count = pgm_read_byte(&sheet[0]);
+    const uint8_t* entry = &sheet[ICON_SHEET_HEADER_SIZE + (id * ICON_INDEX_ENTRY_SIZE)];
+    const uint8_t* data = &sheet[ICON_SHEET_HEADER_SIZE + (count * ICON_INDEX_ENTRY_SIZE) +
+                                 ((pgm_read_byte(&entry[0]) << 8) | pgm_read_byte(&entry[1]))];
+    uint8_t width = pgm_read_byte(&entry[2]);
+    uint8_t pages = pgm_read_byte(&entry[3]);
     
-    // Iterate through the text
-    for (uint16_t i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        
-        // Handle newline character
-        if (c == '\n') {
-            cursor_x = initial_x;
-            cursor_y += font_info.height +  font_info.spacing;
-            continue;
+    if (y % BITS_PER_BYTE != 0) {
+        for (uint8_t p = 0; p < pages; p++) {
+            for (uint8_t i = 0; i < width; i++) {
+                display_blit_byte(x + i, y + (p * BITS_PER_BYTE), pgm_read_byte(&data[(p * width) + i]));
+            }
+        }
+        return;
+    }
+    
+    for (uint8_t p = 0; p < pages; p++) {
+        int16_t page = (y / BITS_PER_BYTE) + p;
+        if (page < 0 || page >= display_config.pages) {
+            continue;
+        }
+        uint8_t* buffer = &display_config.back_buffer[page * display_config.width];
+        for (uint8_t i = 0; i < width; i++) {
+            if (x + i >= 0 && x + i < display_config.width) {
+                uint8_t byte = pgm_read_byte(&data[(p * width) + i]);
+                buffer[x + i] = current_fg_color == DISPLAY_COLOR_WHITE ? byte : (uint8_t)~byte;
+            }
+        }
+    }
+}
+
+/**
+ * Redirect all drawing to a canvas, cleared first, until display_canvas_end()
+ * Canvases cannot be nested
+ */
+bool display_canvas_begin(display_canvas_t* canvas) {
+    if (canvas_active || canvas == NULL || canvas->buffer == NULL) {
+        return false;
+    }
+
+    canvas_saved.width = display_config.width;
+    canvas_saved.height = display_config.height;
+    canvas_saved.pages = display_config.pages;
+    canvas_saved.buffer = display_config.back_buffer;
+
+    display_config.width = canvas->width;
+    display_config.height = canvas->height;
+    display_config.pages = canvas->pages;
+    display_config.back_buffer = canvas->buffer;
+    memset(canvas->buffer, 0, canvas->width * canvas->pages);
+    canvas_active = true;
+
+    return true;
+}
+
+/**
+ * Restore drawing to the back buffer
+ */
+void display_canvas_end(void) {
+    if (!canvas_active) {
+        return;
+    }
+
+    display_config.width = canvas_saved.width;
+    display_config.height = canvas_saved.height;
+    display_config.pages = canvas_saved.pages;
+    display_config.back_buffer = canvas_saved.buffer;
+    canvas_active = false;
+}
+
+/**
+ * Draw the lit pixels of a canvas with the current color
+ */
+void display_draw_canvas(int16_t x, int16_t y, const display_canvas_t* canvas) {
+    if (canvas == NULL || canvas->buffer == NULL) {
+        return;
+    }
+
+    for (uint8_t p = 0; p < canvas->pages; p++) {
+        for (uint8_t i = 0; i < canvas->width; i++) {
+            display_blit_byte(x + i, y + (p * BITS_PER_BYTE), canvas->buffer[(p * canvas->width) + i]);
+        }
+    }
+}
+
+uint16_t get_font_height(){
+    return get_font_info(current_font).height;
+}
+
+/**
+ * Get the height of the specified font, the current font is left unchanged
+ */
+uint16_t get_font_height_with_font(const char* font) {
+    return font != NULL ? get_font_info(font).height : 0;
+}
+
+/**
+ * Start decoding a compressed glyph bitstream
+ */
+static void glyph_decoder_init(glyph_decoder_t* decoder, const char* font, const font_info_t* font_info, uint16_t position) {
+    decoder->font = font;
+    decoder->compressed = (font_info->flags & FONT_FLAG_COMPRESSED) != 0;
+    decoder->huffman_offset = font_info->huffman_offset;
+    decoder->position = position;
+    decoder->current = 0;
+    decoder->bit_mask = 0;
+#if DISPLAY_FONT_FILES
+    font_file_t* font_file = get_font_file(font);
+    decoder->file = font_file ? font_file->file : NULL;
+    decoder->buffer_length = 0;
+#endif //DISPLAY_FONT_FILES
+}
+
+#if DISPLAY_FONT_FILES
+/**
+ * Get the font file of a font, NULL if font is in memory
+ */
+static font_file_t* get_font_file(const char* font) {
+    for (uint8_t i = 0; i <= DISPLAY_FONT_BIG; i++) {
+        if (font_files[i].index && font_files[i].index == font) {
+            return &font_files[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Read next glyph data byte, from the font file through the read buffer if any
+ */
+static uint8_t glyph_decoder_read(glyph_decoder_t* decoder) {
+    uint16_t position = decoder->position++;
+    
+    if (decoder->file == NULL) {
+        return pgm_read_byte(&decoder->font[position]);
+    }
+    
+    if (position < decoder->buffer_start || position >= decoder->buffer_start + decoder->buffer_length) {
+        decoder->buffer_start = position;
+        decoder->buffer_length = 0;
+        if (vfs_seek(decoder->file, position) == 0) {
+            decoder->buffer_length = vfs_read(decoder->buffer, 1, DISPLAY_FONT_FILE_BUFFER, decoder->file);
+        }
+        if (decoder->buffer_length == 0) {
+            return 0; // Read error, draw nothing
+        }
+    }
+    
+    return decoder->buffer[position - decoder->buffer_start];
+}
+#endif //DISPLAY_FONT_FILES
+
+/**
+ * Decode next byte of a compressed glyph (canonical Huffman code, MSB first)
+ */
+static uint8_t glyph_decoder_next(glyph_decoder_t* decoder) {
+    const char* font = decoder->font;
+    
+    if (!decoder->compressed) {
+        return glyph_decoder_read(decoder);
+    }
+    
+    uint8_t max_length = pgm_read_byte(&font[decoder->huffman_offset]);
+    uint16_t symbols_offset = decoder->huffman_offset + 1 + max_length;
+    uint16_t code = 0;  // Code read so far
+    uint16_t first = 0; // First code of current length
+    uint16_t index = 0; // Index of first symbol of current length
+
+    for (uint8_t length = 1; length <= max_length; length++) {
+        // Read next bit
+        if (decoder->bit_mask == 0) {
+            decoder->current = glyph_decoder_read(decoder);
+            decoder->bit_mask = 0x80;
+        }
+        code |= (decoder->current & decoder->bit_mask) ? 1 : 0;
+        decoder->bit_mask >>= 1;
+
+        // Check if code is one of current length
+        uint8_t count = pgm_read_byte(&font[decoder->huffman_offset + length]);
+        if (code - first < count) {
+            return pgm_read_byte(&font[symbols_offset + index + (code - first)]);
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    return 0; // Invalid code
+}
+
+#if DISPLAY_GLYPH_CACHE_SLOTS
+/**
+ * Get a glyph shifted to a y phase from the cache, decoding it on a miss
+ * Returns NULL if the glyph is too big to be cached
+ */
+static glyph_cache_slot_t* glyph_cache_get(const char* font, const font_info_t* font_info, const char_info_t* char_info, uint8_t phase) {
+    uint8_t pages = (phase + (char_info->bytes_per_column * BITS_PER_BYTE) + 7) / BITS_PER_BYTE;
+    
+    if (char_info->columns > DISPLAY_GLYPH_CACHE_COLUMNS || pages > DISPLAY_GLYPH_CACHE_PAGES || char_info->bytes_per_column > 3) {
+        return NULL;
+    }
+    
+    // Look for the glyph, remembering the least recently used slot
+    glyph_cache_slot_t* victim = &glyph_cache[0];
+    glyph_cache_stamp++;
+    for (uint8_t i = 0; i < DISPLAY_GLYPH_CACHE_SLOTS; i++) {
+        glyph_cache_slot_t* slot = &glyph_cache[i];
+        if (slot->font == font && slot->bitmap_offset == char_info->bitmap_offset && slot->phase == phase) {
+            slot->last_used = glyph_cache_stamp;
+            display_stats.glyph_cache_hits++;
+            return slot;
+        }
+        if (slot->font == NULL) {
+            victim = slot;
+        } else if (victim->font != NULL && (uint16_t)(glyph_cache_stamp - slot->last_used) > (uint16_t)(glyph_cache_stamp - victim->last_used)) {
+            victim = slot;
+        }
+    }
+    display_stats.glyph_cache_misses++;
+    
+    // Decode the glyph columns and split them in pages
+    glyph_decoder_t decoder;
+    glyph_decoder_init(&decoder, font, font_info, char_info->bitmap_offset);
+    for (uint8_t j = 0; j < char_info->columns; j++) {
+        uint32_t column = 0;
+        for (uint8_t k = 0; k < char_info->bytes_per_column; k++) {
+            column |= (uint32_t)glyph_decoder_next(&decoder) << (k * BITS_PER_BYTE);
+        }
+        column <<= phase;
+        for (uint8_t p = 0; p < pages; p++) {
+            victim->data[(j * pages) + p] = (uint8_t)(column >> (p * BITS_PER_BYTE));
+        }
+    }
+    
+    victim->font = font;
+    victim->bitmap_offset = char_info->bitmap_offset;
+    victim->phase = phase;
+    victim->columns = char_info->columns;
+    victim->pages = pages;
+    victim->last_used = glyph_cache_stamp;
+    
+    return victim;
+}
+
+#if DISPLAY_FONT_FILES
+/**
+ * Remove all glyphs of a font from the cache
+ */
+static void glyph_cache_forget(const char* font) {
+    for (uint8_t i = 0; i < DISPLAY_GLYPH_CACHE_SLOTS; i++) {
+        if (glyph_cache[i].font == font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+#endif //DISPLAY_FONT_FILES
+#endif //DISPLAY_GLYPH_CACHE_SLOTS
+
+/**
+ * Declare a text row of the layout: the glyphs of chars drawn at y with the font
+ * of font_size are decoded and shifted once, then kept in RAM with the glyphs of
+ * the other rows of the same font and y phase
+ * Returns false if the row can't be kept (no free row or not enough memory),
+ * its strings are then drawn from the font
+ */
+bool display_prepare_text_row(display_font_size_t font_size, int16_t y, const char* chars) {
+#if DISPLAY_TEXT_ROWS
+    const char* font = get_font_by_size(font_size);
+    if (!font || !chars) {
+        return false;
+    }
+
+    // Row of the font and phase, or a free one
+    uint8_t phase = ((y % BITS_PER_BYTE) + BITS_PER_BYTE) % BITS_PER_BYTE;
+    text_row_t* row = NULL;
+    for (uint8_t i = 0; i < DISPLAY_TEXT_ROWS; i++) {
+        if (text_rows[i].font == font && text_rows[i].phase == phase) {
+            row = &text_rows[i];
+            break;
+        }
+        if (row == NULL && text_rows[i].font == NULL) {
+            row = &text_rows[i];
+        }
+    }
+    if (row == NULL) {
+        return false;
+    }
+
+    // Codes of the row: the ones already kept and the new ones
+    font_info_t font_info = get_font_info(font);
+    uint8_t codes[32] = { 0 };
+    uint16_t first = 0xFF, last = 0;
+    bool added = false;
+    for (uint16_t code = 0; row->font && code < row->codes; code++) {
+        if (row->index[code]) {
+            codes[(row->first_code + code) / BITS_PER_BYTE] |= 1 << ((row->first_code + code) % BITS_PER_BYTE);
+        }
+    }
+    for (const char* c = chars; *c; c++) {
+        uint8_t code = (uint8_t)*c;
+        if (!(codes[code / BITS_PER_BYTE] & (1 << (code % BITS_PER_BYTE))) &&
+            get_char_info_with_font_info(font, &font_info, *c).is_defined) {
+            codes[code / BITS_PER_BYTE] |= 1 << (code % BITS_PER_BYTE);
+            added = true;
+        }
+    }
+    if (!added) {
+        return true;
+    }
+
+    // Size of the glyphs, the index and the column bytes
+    uint16_t glyph_count = 0;
+    uint32_t bytes = 0;
+    for (uint16_t code = 1; code < 0x100; code++) {
+        if (codes[code / BITS_PER_BYTE] & (1 << (code % BITS_PER_BYTE))) {
+            char_info_t char_info = get_char_info_with_font_info(font, &font_info, (char)code);
+            uint8_t glyph_phase = (phase + char_info.y_offset) % BITS_PER_BYTE;
+            uint8_t pages = char_info.bytes ? (glyph_phase + (char_info.bytes_per_column * BITS_PER_BYTE) + 7) / BITS_PER_BYTE : 0;
+            bytes += char_info.bytes ? char_info.columns * pages : 0;
+            first = code < first ? code : first;
+            last = code;
+            glyph_count++;
+        }
+    }
+    uint16_t index_size = last - first + 1;
+    if (glyph_count > 0xFE || bytes > 0xFFFF) {
+        return false;
+    }
+    text_row_glyph_t* glyphs = (text_row_glyph_t*)malloc((glyph_count * sizeof(text_row_glyph_t)) + index_size + bytes);
+    if (glyphs == NULL) {
+        return false;
+    }
+    uint8_t* index = (uint8_t*)&glyphs[glyph_count];
+    uint8_t* data = index + index_size;
+    memset(index, 0, index_size);
+
+    // Decode the glyph columns and split them in pages shifted to the row phase
+    uint8_t n = 0;
+    uint16_t offset = 0;
+    for (uint16_t code = first; code <= last; code++) {
+        if (!(codes[code / BITS_PER_BYTE] & (1 << (code % BITS_PER_BYTE)))) {
+            continue;
+        }
+        char_info_t char_info = get_char_info_with_font_info(font, &font_info, (char)code);
+        text_row_glyph_t* glyph = &glyphs[n];
+        uint8_t glyph_phase = (phase + char_info.y_offset) % BITS_PER_BYTE;
+        glyph->data = offset;
+        glyph->width = char_info.width;
+        glyph->x_offset = char_info.x_offset;
+        glyph->page = (phase + char_info.y_offset) / BITS_PER_BYTE;
+        glyph->columns = char_info.bytes ? char_info.columns : 0;
+        glyph->pages = char_info.bytes ? (glyph_phase + (char_info.bytes_per_column * BITS_PER_BYTE) + 7) / BITS_PER_BYTE : 0;
+        index[code - first] = ++n;
+        if (glyph->columns == 0) {
+            continue;
+        }
+
+        glyph_decoder_t decoder;
+        glyph_decoder_init(&decoder, font, &font_info, char_info.bitmap_offset);
+        memset(&data[offset], 0, glyph->columns * glyph->pages);
+        for (uint8_t j = 0; j < glyph->columns; j++) {
+            uint8_t* column = &data[offset + (j * glyph->pages)];
+            for (uint8_t k = 0; k < char_info.bytes_per_column; k++) {
+                uint8_t bits = glyph_decoder_next(&decoder);
+                column[k] |= bits << glyph_phase;
+                if (glyph_phase) {
+                    column[k + 1] |= bits >> (BITS_PER_BYTE - glyph_phase);
+                }
+            }
+        }
+        offset += glyph->columns * glyph->pages;
+    }
+
+    if (row->font) {
+        free(row->glyphs);
+    }
+    row->font = font;
+    row->phase = phase;
+    row->first_code = first;
+    row->codes = index_size;
+    row->glyphs = glyphs;
+    row->index = index;
+    row->data = data;
+
+    return true;
+#else
+    (void)font_size;
+    (void)y;
+    (void)chars;
+    return false;
+#endif //DISPLAY_TEXT_ROWS
+}
+
+#if DISPLAY_TEXT_ROWS
+/**
+ * Get the declared text row of a font drawn at y
+ * Returns NULL if no row of the font was declared with the phase of y
+ */
+static const text_row_t* text_row_find(const char* font, int16_t y) {
+    uint8_t phase = ((y % BITS_PER_BYTE) + BITS_PER_BYTE) % BITS_PER_BYTE;
+    for (uint8_t i = 0; i < DISPLAY_TEXT_ROWS; i++) {
+        if (text_rows[i].font == font && text_rows[i].phase == phase) {
+            return &text_rows[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Get the glyph of a character in a text row
+ * Returns NULL if the character was not declared for the row
+ */
+static const text_row_glyph_t* text_row_glyph(const text_row_t* row, char c) {
+    uint16_t code = (uint8_t)c - row->first_code;
+    if ((uint8_t)c < row->first_code || code >= row->codes || row->index[code] == 0) {
+        return NULL;
+    }
+    return &row->glyphs[row->index[code] - 1];
+}
+
+/**
+ * Draw a glyph of a text row whose top is at y, each byte is written in its page
+ */
+static void text_row_draw(const text_row_t* row, const text_row_glyph_t* glyph, int16_t x, int16_t y) {
+    // The row top is phase rows below a page boundary
+    int16_t top = ((y - row->phase) / BITS_PER_BYTE) + glyph->page;
+    int16_t x_start = x + glyph->x_offset;
+    const uint8_t* data = &row->data[glyph->data];
+
+    for (uint8_t j = 0; j < glyph->columns; j++, data += glyph->pages) {
+        if (x_start + j < 0 || x_start + j >= display_config.width) {
+            continue;
+        }
+        uint8_t* column = &display_config.back_buffer[x_start + j];
+        for (uint8_t p = 0; p < glyph->pages; p++) {
+            if (top + p < 0 || top + p >= display_config.pages) {
+                continue;
+            }
+            if (current_fg_color == DISPLAY_COLOR_WHITE) {
+                column[(top + p) * display_config.width] |= data[p];
+            } else {
+                column[(top + p) * display_config.width] &= ~data[p];
+            }
+        }
+    }
+    display_stats.text_row_glyphs++;
+}
+
+#if DISPLAY_FONT_FILES
+/**
+ * Free the text rows of a font, before the font is freed
+ */
+static void text_row_forget(const char* font) {
+    for (uint8_t i = 0; i < DISPLAY_TEXT_ROWS; i++) {
+        if (text_rows[i].font == font) {
+            free(text_rows[i].glyphs);
+            text_rows[i].font = NULL;
+        }
+    }
+}
+#endif //DISPLAY_FONT_FILES
+#endif //DISPLAY_TEXT_ROWS
+
+/**
+ * Draw a glyph from already decoded font and character information
+ * Only the stored (inked) bytes are written, a byte at a time
+ */
+static int16_t display_draw_glyph(int16_t x, int16_t y, const char* font, const font_info_t* font_info, const char_info_t* char_info) {
+    // If character is not defined OR has no bitmap data, just return its width
+    if (!char_info->is_defined || char_info->bytes == 0) {
+        return char_info->width + font_info->spacing;
+    }
+
+    int16_t x_start = x + char_info->x_offset;
+    int16_t y_start = y + char_info->y_offset;
+    uint16_t byte_offset = char_info->bitmap_offset;
+
+#if DISPLAY_GLYPH_CACHE_SLOTS
+    // Copy page aligned bytes from the cache
+    uint8_t phase = ((y_start % BITS_PER_BYTE) + BITS_PER_BYTE) % BITS_PER_BYTE;
+    glyph_cache_slot_t* slot = glyph_cache_get(font, font_info, char_info, phase);
+    if (slot) {
+        const uint8_t* data = slot->data;
+        for (uint8_t j = 0; j < slot->columns; j++) {
+            for (uint8_t p = 0; p < slot->pages; p++) {
+                display_blit_byte(x_start + j, y_start - phase + (p * BITS_PER_BYTE), *data++);
+            }
+        }
+        return char_info->width + font_info->spacing;
+    }
+#endif //DISPLAY_GLYPH_CACHE_SLOTS
+
+    bool use_decoder = (font_info->flags & FONT_FLAG_COMPRESSED) != 0;
+#if DISPLAY_FONT_FILES
+    // Glyph data of font files is not in memory
+    use_decoder = use_decoder || get_font_file(font) != NULL;
+#endif //DISPLAY_FONT_FILES
+
+    if (use_decoder) {
+        // Decode straight into the back buffer
+        glyph_decoder_t decoder;
+        glyph_decoder_init(&decoder, font, font_info, byte_offset);
+        for (uint8_t j = 0; j < char_info->columns; j++) {
+            for (uint8_t k = 0; k < char_info->bytes_per_column; k++) {
+                display_blit_byte(x_start + j, y_start + (k * BITS_PER_BYTE), glyph_decoder_next(&decoder));
+            }
+        }
+    } else {
+        for (uint8_t j = 0; j < char_info->columns; j++) {
+            for (uint8_t k = 0; k < char_info->bytes_per_column; k++) {
+                display_blit_byte(x_start + j, y_start + (k * BITS_PER_BYTE), pgm_read_byte(&font[byte_offset++]));
+            }
+        }
+    }
+
+    // Return the width plus spacing
+    return char_info->width + font_info->spacing;
+}
+
+/**
+ * Draw a single character with the specified font
+ */
+int16_t display_draw_char(int16_t x, int16_t y, char c, const char* font) {
+    if (font == NULL) {
+        return 0;
+    }
+    
+    // Get font and character information
+    font_info_t font_info = get_font_info(font);
+    char_info_t char_info = get_char_info_with_font_info(font, &font_info, c);
+
+    return display_draw_glyph(x, y, font, &font_info, &char_info);
+}
+
+/**
+ * Draw a string with the specified font
+ */
+int16_t display_draw_string_with_font(int16_t x, int16_t y, const char* text, const char* font) {
+    if (text == NULL || font == NULL) return 0;
+    
+    font_info_t font_info = get_font_info(font);
+    int16_t cursor_x = x;
+    int16_t cursor_y = y;
+    int16_t initial_x = x;
+#if DISPLAY_TEXT_ROWS
+    const text_row_t* row = text_row_find(font, cursor_y);
+#endif //DISPLAY_TEXT_ROWS
+    
+    // Iterate through the text
+    for (uint16_t i = 0; text[i] != '\0'; i++) {
+        char c = text[i];
+        
+        // Handle newline character
+        if (c == '\n') {
+            cursor_x = initial_x;
+            cursor_y += font_info.height +  font_info.spacing;
+#if DISPLAY_TEXT_ROWS
+            row = text_row_find(font, cursor_y);
+#endif //DISPLAY_TEXT_ROWS
+            continue;
+        }
+
+#if DISPLAY_TEXT_ROWS
+        // Glyphs of a declared text row are already shifted, unless the string wraps
+        const text_row_glyph_t* glyph = row ? text_row_glyph(row, c) : NULL;
+        if (glyph != NULL && cursor_x + glyph->width <= display_config.width) {
+            text_row_draw(row, glyph, cursor_x, cursor_y);
+            cursor_x += glyph->width + font_info.spacing;
+            continue;
+        }
+#endif //DISPLAY_TEXT_ROWS
+        
+        // Get character information
+        char_info_t char_info = get_char_info_with_font_info(font, &font_info, c);
+        
+        // Check if we need to wrap
+        if (cursor_x + char_info.width > display_config.width) {
+            cursor_x = initial_x;
+            cursor_y += font_info.height + font_info.spacing;
+#if DISPLAY_TEXT_ROWS
+            row = text_row_find(font, cursor_y);
+#endif //DISPLAY_TEXT_ROWS
+            
+            // Check if we've reached bottom of screen
+            if (cursor_y > display_config.height - font_info.height) {
+                break;
+            }
+        }
+        
+        // Skip rendering if completely off-screen
+        if (cursor_x + char_info.width < 0 || cursor_y + font_info.height < 0 || cursor_y >= display_config.height) {
+            cursor_x += char_info.width + font_info.spacing;
+            continue;
+        }
+        
+        // Draw the character and advance cursor
+        int16_t char_width = display_draw_glyph(cursor_x, cursor_y, font, &font_info, &char_info);
+        cursor_x += char_width;
+    }
+    
+    // Return the width of the string (distance from initial x position)
+    return cursor_x - initial_x;
+}
+
+#if DISPLAY_TEXT_CACHE_ENTRIES
+/**
+ * Copy a canvas to the back buffer, unlit pixels included
+ */
+static void display_copy_canvas(int16_t x, int16_t y, const display_canvas_t* canvas) {
+    int16_t first = x < 0 ? -x : 0;
+    int16_t end = x + canvas->width > display_config.width ? display_config.width - x : canvas->width;
+
+    for (uint8_t p = 0; p < canvas->pages; p++) {
+        int16_t top = y + (p * BITS_PER_BYTE);
+        if (top <= -BITS_PER_BYTE || top >= display_config.height) {
+            continue;
+        }
+
+        // Rows of the canvas in this page, then their position in the display pages
+        uint8_t rows = canvas->height - (p * BITS_PER_BYTE);
+        uint8_t mask = rows >= BITS_PER_BYTE ? 0xFF : (1 << rows) - 1;
+        int16_t page = top >= 0 ? top / BITS_PER_BYTE : -1;
+        uint8_t shift = top - (page * BITS_PER_BYTE);
+        const uint8_t* source = &canvas->buffer[p * canvas->width];
+
+        for (int16_t i = first; i < end; i++) {
+            uint8_t* column = &display_config.back_buffer[x + i];
+            uint8_t bits = source[i] & mask;
+            if (page >= 0) {
+                uint8_t* byte = &column[page * display_config.width];
+                *byte = (*byte & ~(mask << shift)) | (bits << shift);
+            }
+            if (shift != 0 && page + 1 < display_config.pages) {
+                uint8_t* byte = &column[(page + 1) * display_config.width];
+                *byte = (*byte & ~(mask >> (BITS_PER_BYTE - shift))) | (bits >> (BITS_PER_BYTE - shift));
+            }
+        }
+    }
+}
+
+/**
+ * Get a string drawn at x with the current font and color from the cache, drawing it
+ * with its background in the least recently used entry on a miss
+ * Returns NULL if the string is not cached: too long or too big, multiline, wrapped at
+ * the display edge, or drawn in a canvas
+ */
+/**
+ * FNV-1a hash of a string for the text cache, entries are compared only if the hashes are equal
+ * Returns false if the string can't be cached: too long, multiline or drawn in a canvas
+ */
+static bool text_cache_hash(const char* text, uint32_t* hash) {
+    *hash = 2166136261u;
+    for (uint16_t length = 0; text[length] != '\0'; length++) {
+        if (length == DISPLAY_TEXT_CACHE_TEXT || text[length] == '\n') {
+            return false;
+        }
+        *hash = (*hash ^ (uint8_t)text[length]) * 16777619u;
+    }
+    return !canvas_active;
+}
+
+/**
+ * Find a string drawn with the current font and color in the cache, wherever it is drawn
+ * Returns NULL if the string is not cached, nothing is drawn on a miss
+ */
+static text_cache_entry_t* text_cache_find(const char* text) {
+    uint32_t hash;
+    if (!text_cache_hash(text, &hash)) {
+        return NULL;
+    }
+
+    text_cache_stamp++;
+    for (uint8_t i = 0; i < DISPLAY_TEXT_CACHE_ENTRIES; i++) {
+        text_cache_entry_t* entry = &text_cache[i];
+        if (entry->font == current_font && entry->hash == hash && entry->color == current_fg_color && strcmp(entry->text, text) == 0) {
+            display_stats.text_cache_hits++;
+            entry->last_used = text_cache_stamp;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static text_cache_entry_t* text_cache_get(int16_t x, const char* text) {
+    uint32_t hash;
+    if (!text_cache_hash(text, &hash)) {
+        return NULL;
+    }
+
+    // Look for the string, remembering the least recently used entry
+    text_cache_entry_t* victim = NULL;
+    text_cache_stamp++;
+    for (uint8_t i = 0; i < DISPLAY_TEXT_CACHE_ENTRIES; i++) {
+        text_cache_entry_t* entry = &text_cache[i];
+        if (entry->font == current_font && entry->hash == hash && entry->color == current_fg_color && strcmp(entry->text, text) == 0) {
+            if (x + entry->canvas.width - 2 > display_config.width) {
+                return NULL;
+            }
+            display_stats.text_cache_hits++;
+            entry->last_used = text_cache_stamp;
+            return entry;
+        }
+        if (entry->font == NULL) {
+            victim = entry;
+        } else if (victim == NULL || (victim->font != NULL && (uint16_t)(text_cache_stamp - entry->last_used) > (uint16_t)(text_cache_stamp - victim->last_used))) {
+            victim = entry;
+        }
+    }
+
+    // The box of display_draw_string(): 1 pixel around the string
+    char* ascii_text = utf8_string_to_ascii(text);
+    font_info_t font_info = get_font_info(current_font);
+    uint16_t width = get_string_width_with_font(ascii_text, strlen(ascii_text), current_font) + 2;
+    uint8_t height = font_info.height + 2;
+    uint8_t pages = (height + 7) / BITS_PER_BYTE;
+    if (x + width - 2 > display_config.width || width > 0xFF || (width * pages) > DISPLAY_TEXT_CACHE_BYTES) {
+        if (ascii_text != text) {
+            free(ascii_text);
+        }
+        return NULL;
+    }
+    display_stats.text_cache_misses++;
+
+    // Draw the string and its background in the entry canvas
+    victim->font = NULL;
+    victim->canvas.width = width;
+    victim->canvas.height = height;
+    victim->canvas.pages = pages;
+    victim->canvas.buffer = victim->data;
+    if (display_canvas_begin(&victim->canvas)) {
+        display_color_t original_color = current_fg_color;
+        display_set_color(current_bg_color);
+        display_fill_rect(0, 0, width, height);
+        display_set_color(original_color);
+        victim->advance = display_draw_string_with_font(1, 1, ascii_text, current_font);
+        display_canvas_end();
+
+        strcpy(victim->text, text);
+        victim->hash = hash;
+        victim->font = current_font;
+        victim->color = current_fg_color;
+        victim->last_used = text_cache_stamp;
+    }
+
+    if (ascii_text != text) {
+        free(ascii_text);
+    }
+    return victim->font != NULL ? victim : NULL;
+}
+
+#if DISPLAY_FONT_FILES
+/**
+ * Remove the strings of a font from the text cache, before the font is freed
+ */
+static void text_cache_forget(const char* font) {
+    for (uint8_t i = 0; i < DISPLAY_TEXT_CACHE_ENTRIES; i++) {
+        if (text_cache[i].font == font) {
+            text_cache[i].font = NULL;
+        }
+    }
+}
+#endif //DISPLAY_FONT_FILES
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+
+/**
+ * Draw a string with the current font
+ */
+int16_t display_draw_string(int16_t x, int16_t y, const char* text) {
+    if (text == NULL) return 0;
+    
+    // Use default font if none is set
+    if (current_font == NULL) {
+        current_font = display_config.display_small_font;
+    }
+
+#if DISPLAY_TEXT_CACHE_ENTRIES
+    // Copy the string and its background if they are in the cache
+    text_cache_entry_t* entry = text_cache_get(x, text);
+    if (entry != NULL) {
+        display_copy_canvas(x - 1, y - 1, &entry->canvas);
+        return entry->advance;
+    }
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+
+    // Convert to ASCII if text might be UTF-8
+    char* ascii_text = utf8_string_to_ascii(text);
+    
+    // Calculate string dimensions
+    uint16_t text_width = get_string_width_with_font(ascii_text, strlen(ascii_text), current_font);
+    
+    int16_t width = display_draw_string_box(x, y, ascii_text, text_width);
+    
+    // Free the allocated string if different from original
+    if (ascii_text != text) {
+        free(ascii_text);
+    }
+    
+    return width;
+}
+
+/**
+ * Draw an ASCII string with the current font over its background, 1 pixel around it
+ */
+static int16_t display_draw_string_box(int16_t x, int16_t y, const char* text, uint16_t text_width) {
+    // Clear the area where the string will be drawn
+    display_rect_pages(x - 1, y - 1, text_width + 2, get_font_info(current_font).height + 2,
+                       current_bg_color == DISPLAY_COLOR_WHITE ? RECT_SET : RECT_CLEAR);
+
+    // Draw the string
+    return display_draw_string_with_font(x, y, text, current_font);
+}
+
+/**
+ * Draw strings as display_draw_string() does, each with its font, color and alignment
+ * Fonts are resolved and widths measured for all strings first, then strings are drawn
+ * from the top of the display so the pages are written one after the other: strings must
+ * not overlap, they are not drawn in the order of the array
+ * Cached strings are neither converted nor measured, their width is the one of the entry
+ * The left edge and the width of each string are set in its record
+ * More than DISPLAY_STRINGS_MAX strings are drawn in batches of DISPLAY_STRINGS_MAX
+ */
+void display_draw_strings(display_string_t* strings, uint8_t count) {
+    const char* original_font = current_font;
+    display_color_t original_color = current_fg_color;
+    char* ascii_texts[DISPLAY_STRINGS_MAX];
+#if DISPLAY_TEXT_CACHE_ENTRIES
+    text_cache_entry_t* entries[DISPLAY_STRINGS_MAX];
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+    uint8_t order[DISPLAY_STRINGS_MAX];
+
+    if (count > DISPLAY_STRINGS_MAX) {
+        for (uint8_t first = 0; first < count; first += DISPLAY_STRINGS_MAX) {
+            display_draw_strings(&strings[first], count - first > DISPLAY_STRINGS_MAX ? DISPLAY_STRINGS_MAX : count - first);
+        }
+        return;
+    }
+
+    // Fonts, widths and positions
+    for (uint8_t i = 0; i < count; i++) {
+        display_string_t* string = &strings[i];
+        const char* font = get_font_by_size(string->font);
+
+        ascii_texts[i] = NULL;
+        string->width = 0;
+#if DISPLAY_TEXT_CACHE_ENTRIES
+        entries[i] = NULL;
+        if (string->text) {
+            current_font = font;
+            display_set_color(string->color);
+            entries[i] = text_cache_find(string->text);
+        }
+        if (entries[i] != NULL) {
+            string->width = entries[i]->canvas.width - 2;
+        } else
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+        if (string->text) {
+            ascii_texts[i] = utf8_string_to_ascii(string->text);
+            string->width = get_string_width_with_font(ascii_texts[i], strlen(ascii_texts[i]), font);
+        }
+        switch (string->align) {
+            case DISPLAY_ALIGN_RIGHT:
+                string->left = string->x - string->width;
+                break;
+            case DISPLAY_ALIGN_CENTER:
+                string->left = string->x - (string->width / 2);
+                break;
+            default:
+                string->left = string->x;
+                break;
+        }
+
+        // Insertion in the order of the tops
+        uint8_t n = i;
+        while (n > 0 && strings[order[n - 1]].y > string->y) {
+            order[n] = order[n - 1];
+            n--;
+        }
+        order[n] = i;
+    }
+
+    for (uint8_t n = 0; n < count; n++) {
+        uint8_t i = order[n];
+        display_string_t* string = &strings[i];
+        if (string->text == NULL) {
+            continue;
+        }
+
+        current_font = get_font_by_size(string->font);
+        display_set_color(string->color);
+#if DISPLAY_TEXT_CACHE_ENTRIES
+        // An entry found above may have been replaced by a miss of an earlier string,
+        // and is copied only if the string fits before the display edge
+        text_cache_entry_t* entry = entries[i];
+        if (entry != NULL && (entry->font != current_font || entry->color != current_fg_color ||
+                              strcmp(entry->text, string->text) != 0 || string->left + string->width > display_config.width)) {
+            entry = NULL;
+        }
+        if (entry == NULL && ascii_texts[i] == NULL) {
+            ascii_texts[i] = utf8_string_to_ascii(string->text);
+        }
+        if (entry == NULL) {
+            entry = text_cache_get(string->left, string->text);
+        }
+        if (entry != NULL) {
+            display_copy_canvas(string->left - 1, string->y - 1, &entry->canvas);
+        } else
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+        {
+            display_draw_string_box(string->left, string->y, ascii_texts[i], string->width);
+        }
+
+        if (ascii_texts[i] != NULL && ascii_texts[i] != string->text) {
+            free(ascii_texts[i]);
+        }
+    }
+
+    current_font = original_font;
+    display_set_color(original_color);
+}
+
+/**
+ * Get the width of a string with the specified font
+ */
+uint16_t get_string_width_with_font(const char* text, uint16_t length, const char* font) {
+    if (text == NULL || length == 0 || font == NULL) return 0;
+    
+    uint16_t total_width = 0;
+    font_info_t font_info = get_font_info(font);
+    // Iterate through the text up to given length
+    for (uint16_t i = 0; i < length && text[i] != '\0'; i++) {
+        char c = text[i];
+        
+        // Handle newline character
+        if (c == '\n') {
+            break; // Width calculation assumes single line
+        }
+        
+        // Get character information
+        char_info_t char_info = get_char_info_with_font_info(font, &font_info, c);
+        
+        // Add the character width to the total
+        total_width += char_info.width +  font_info.spacing;
+    }
+    
+    // Remove the last character spacing if there was at least one character
+    if (total_width > 0 && length > 0) {
+        total_width -=  font_info.spacing;
+    }
+    
+    return total_width;
+}
+
+/**
+ * Get the width of a string with current font
+ */
+uint16_t get_string_width(const char* text) {
+    if (text == NULL) return 0;
+    
+    // Use default font if none is set
+    if (current_font == NULL) {
+        current_font = display_config.display_small_font;
+    }
+    
+    return get_string_width_with_font(text, strlen(text), current_font);
+}
+
+#if DISPLAY_STROKE_FONT
+/**
+ * Find the index of a character in the stroke font, lowercase letters use capitals
+ * Returns -1 if the character is not defined
+ */
+static int16_t find_stroke_char(char c) {
+    if (c >= 'a' && c <= 'z') {
+        c -= 'a' - 'A';
+    }
+
+    uint8_t count = pgm_read_byte(&stroke_font[1]);
+    for (uint8_t i = 0; i < count; i++) {
+        if (pgm_read_byte(&stroke_font[STROKE_HEADER_SIZE + i]) == (uint8_t)c) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Scale a stroke grid coordinate to pixels, the grid height spans height pixels
+ */
+static inline int16_t stroke_to_pixels(uint8_t coord, uint8_t height) {
+    uint8_t grid = pgm_read_byte(&stroke_font[0]);
+    return ((coord * (height - 1)) + (grid / 2)) / grid;
+}
+
+/**
+ * Space between stroke characters, growing with the height
+ */
+static inline uint8_t get_stroke_spacing(uint8_t height) {
+    return 1 + (height / 16);
+}
+
+/**
+ * Get the width in pixels of a stroke font character, without spacing
+ */
+static uint8_t get_stroke_char_width(int16_t index, uint8_t height) {
+    uint8_t count = pgm_read_byte(&stroke_font[1]);
+    uint8_t width = pgm_read_byte(&stroke_font[STROKE_HEADER_SIZE + count + (index * STROKE_JUMPTABLE_BYTES_PER_CHAR) + 2]);
+    return stroke_to_pixels(width - 1, height) + 1;
+}
+
+/**
+ * Draw a stroke font character, undefined characters are drawn as spaces
+ * Returns the width plus spacing
+ */
+static int16_t display_draw_stroke_char(int16_t x, int16_t y, char c, uint8_t height) {
+    int16_t index = find_stroke_char(c);
+    if (index < 0) {
+        index = find_stroke_char(' ');
+        if (index < 0) {
+            return 0;
+        }
+    }
+
+    uint8_t count = pgm_read_byte(&stroke_font[1]);
+    const uint8_t* entry = &stroke_font[STROKE_HEADER_SIZE + count + (index * STROKE_JUMPTABLE_BYTES_PER_CHAR)];
+    const uint8_t* strokes = &stroke_font[STROKE_HEADER_SIZE + (count * (1 + STROKE_JUMPTABLE_BYTES_PER_CHAR)) +
+                                          ((pgm_read_byte(&entry[0]) << 8) | pgm_read_byte(&entry[1]))];
+
+    // Draw each polyline through the clipped line drawing
+    bool pen_down = false;
+    int16_t last_x = 0;
+    int16_t last_y = 0;
+    for (uint16_t i = 0; ; i++) {
+        uint8_t point = pgm_read_byte(&strokes[i]);
+        if (point == STROKE_GLYPH_END) {
+            break;
+        }
+        if (point == STROKE_PEN_UP) {
+            pen_down = false;
+            continue;
+        }
+        int16_t point_x = x + stroke_to_pixels(point >> 4, height);
+        int16_t point_y = y + stroke_to_pixels(point & 0x0F, height);
+        if (pen_down) {
+            display_draw_line(last_x, last_y, point_x, point_y);
+        }
+        last_x = point_x;
+        last_y = point_y;
+        pen_down = true;
+    }
+
+    return get_stroke_char_width(index, height) + get_stroke_spacing(height);
+}
+
+#if DISPLAY_STROKE_CACHE_ENTRIES
+/**
+ * Get a stroke string from the cache, drawing it in the least recently used entry on a miss
+ * Returns NULL if the string is too big to be cached or drawn in a canvas
+ */
+static stroke_cache_entry_t* stroke_cache_get(const char* text, uint8_t height) {
+    // A miss is drawn in the entry canvas, which cannot be nested in another one
+    if (strlen(text) > DISPLAY_STROKE_CACHE_TEXT || canvas_active) {
+        return NULL;
+    }
+
+    // Look for the string, remembering the least recently used entry
+    stroke_cache_entry_t* victim = NULL;
+    stroke_cache_stamp++;
+    for (uint8_t i = 0; i < DISPLAY_STROKE_CACHE_ENTRIES; i++) {
+        stroke_cache_entry_t* entry = &stroke_cache[i];
+        if (entry->text[0] != '\0' && entry->height == height && strcmp(entry->text, text) == 0) {
+            display_stats.stroke_cache_hits++;
+            entry->last_used = stroke_cache_stamp;
+            return entry;
+        }
+        if (entry->text[0] == '\0') {
+            victim = entry;
+        } else if (victim == NULL || (victim->text[0] != '\0' && (uint16_t)(stroke_cache_stamp - entry->last_used) > (uint16_t)(stroke_cache_stamp - victim->last_used))) {
+            victim = entry;
+        }
+    }
+
+    uint16_t width = get_stroke_string_width(text, height);
+    uint8_t pages = (height + 7) / BITS_PER_BYTE;
+    if (width == 0 || width > 0xFF || (width * pages) > DISPLAY_STROKE_CACHE_BYTES) {
+        return NULL;
+    }
+    display_stats.stroke_cache_misses++;
+
+    // Draw the string in white in the entry canvas
+    victim->text[0] = '\0';
+    victim->canvas.width = width;
+    victim->canvas.height = height;
+    victim->canvas.pages = pages;
+    victim->canvas.buffer = victim->data;
+    if (!display_canvas_begin(&victim->canvas)) {
+        return NULL;
+    }
+    display_color_t original_color = current_fg_color;
+    display_set_color(DISPLAY_COLOR_WHITE);
+    int16_t cursor_x = 0;
+    for (uint16_t i = 0; text[i] != '\0'; i++) {
+        cursor_x += display_draw_stroke_char(cursor_x, 0, text[i], height);
+    }
+    display_set_color(original_color);
+    display_canvas_end();
+
+    strcpy(victim->text, text);
+    victim->height = height;
+    victim->last_used = stroke_cache_stamp;
+
+    return victim;
+}
+#endif //DISPLAY_STROKE_CACHE_ENTRIES
+#endif //DISPLAY_STROKE_FONT
+
+/**
+ * Draw a string with the stroke font, height being the capital height in pixels
+ * Only digits, capitals and the DRO punctuation are defined, other characters are spaces
+ * Returns the width plus spacing
+ */
+int16_t display_draw_stroke_string(int16_t x, int16_t y, const char* text, uint8_t height) {
+#if DISPLAY_STROKE_FONT
+    if (text == NULL || text[0] == '\0' || height < 2) {
+        return 0;
+    }
+
+#if DISPLAY_STROKE_CACHE_ENTRIES
+    // Copy the string already drawn if it is in the cache
+    stroke_cache_entry_t* entry = stroke_cache_get(text, height);
+    if (entry != NULL) {
+        display_draw_canvas(x, y, &entry->canvas);
+        return entry->canvas.width + get_stroke_spacing(height);
+    }
+#endif //DISPLAY_STROKE_CACHE_ENTRIES
+
+    int16_t cursor_x = x;
+    for (uint16_t i = 0; text[i] != '\0'; i++) {
+        cursor_x += display_draw_stroke_char(cursor_x, y, text[i], height);
+    }
+    return cursor_x - x;
+#else
+    (void)x;
+    (void)y;
+    (void)text;
+    (void)height;
+    return 0;
+#endif //DISPLAY_STROKE_FONT
+}
+
+/**
+ * Get the width of a string with the stroke font
+ */
+uint16_t get_stroke_string_width(const char* text, uint8_t height) {
+#if DISPLAY_STROKE_FONT
+    if (text == NULL || text[0] == '\0' || height < 2) {
+        return 0;
+    }
+
+    int16_t space = find_stroke_char(' ');
+    uint16_t total_width = 0;
+    for (uint16_t i = 0; text[i] != '\0'; i++) {
+        int16_t index = find_stroke_char(text[i]);
+        if (index < 0) {
+            index = space;
+        }
+        if (index >= 0) {
+            total_width += get_stroke_char_width(index, height) + get_stroke_spacing(height);
+        }
+    }
+
+    // Remove the last character spacing
+    if (total_width > 0) {
+        total_width -= get_stroke_spacing(height);
+    }
+    return total_width;
+#else
+    (void)text;
+    (void)height;
+    return 0;
+#endif //DISPLAY_STROKE_FONT
+}
+
+#if DISPLAY_OVERLAYS
+/**
+ * Get the 8 rows of a canvas column starting at row offset (negative above the canvas)
+ */
+static uint8_t canvas_page_bits(const display_canvas_t* canvas, uint8_t column, int16_t offset) {
+    if (offset < 0) {
+        return canvas->buffer[column] << -offset;
+    }
+
+    uint8_t canvas_page = offset / BITS_PER_BYTE;
+    uint8_t shift = offset % BITS_PER_BYTE;
+    uint8_t bits = canvas->buffer[(canvas_page * canvas->width) + column] >> shift;
+    if (shift != 0 && canvas_page + 1 < canvas->pages) {
+        bits |= canvas->buffer[((canvas_page + 1) * canvas->width) + column] << (BITS_PER_BYTE - shift);
+    }
+    return bits;
+}
+#endif //DISPLAY_OVERLAYS
+
+/**
+ * Get a page of the back buffer as sent to the display, with the visible overlays composed
+ */
+static const uint8_t* display_compose_page(uint8_t page) {
+    const uint8_t* back = display_config.back_buffer + (page * display_config.width);
+#if DISPLAY_OVERLAYS
+    bool composed = false;
+    int16_t page_top = page * BITS_PER_BYTE;
+    
+    for (uint8_t o = 0; o < overlay_count; o++) {
+        const display_overlay_t* overlay = overlay_order[o];
+        if (!overlay->visible || overlay->y >= page_top + BITS_PER_BYTE || overlay->y + overlay->canvas.height <= page_top) {
+            continue;
+        }
+        if (!composed) {
+            memcpy(overlay_page, back, display_config.width);
+            composed = true;
+        }
+        
+        // Rows of the page covered by the overlay, and overlay rows shifted to the page
+        int16_t offset = page_top - overlay->y;
+        int16_t first = offset < 0 ? -offset : 0;
+        int16_t last = overlay->canvas.height - offset < BITS_PER_BYTE ? overlay->canvas.height - offset : BITS_PER_BYTE;
+        uint8_t mask = (uint8_t)((0xFF << first) & (0xFF >> (BITS_PER_BYTE - last)));
+        for (uint8_t i = 0; i < overlay->canvas.width; i++) {
+            int16_t column = overlay->x + i;
+            if (column < 0 || column >= display_config.width) {
+                continue;
+            }
+            uint8_t bits = canvas_page_bits(&overlay->canvas, i, offset);
+#if DISPLAY_GRAY
+            // The canvas is the high bit of the level, the gray plane the low bit:
+            // lit in the first frame of the cycle if any bit is set, in the last one if both are
+            if (overlay->gray.buffer) {
+                uint8_t low = canvas_page_bits(&overlay->gray, i, offset);
+                if (gray_phase == 0) {
+                    bits |= low;
+                } else if (gray_phase == 2) {
+                    bits &= low;
+                }
+            }
+#endif //DISPLAY_GRAY
+            overlay_page[column] = (overlay_page[column] & ~mask) | (bits & mask);
+        }
+    }
+    
+    if (composed) {
+        return overlay_page;
+    }
+#endif //DISPLAY_OVERLAYS
+    return back;
+}
+
+/**
+ * Reserve a region of the screen for another plugin, drawn over the screen content
+ * with display_overlay_begin()/display_overlay_end(), higher priority overlays
+ * being drawn over lower ones
+ * The overlay is hidden until display_overlay_show() is called
+ * Returns NULL if no overlay is left or not enough memory
+ */
+display_overlay_t* display_overlay_add(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t priority) {
+#if DISPLAY_OVERLAYS
+    display_overlay_t* overlay = NULL;
+    
+    if (width == 0 || height == 0 || display_config.front_buffer == NULL) {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < DISPLAY_OVERLAYS && overlay == NULL; i++) {
+        if (overlays[i].canvas.buffer == NULL) {
+            overlay = &overlays[i];
+        }
+    }
+    if (overlay_page == NULL) {
+        // A row of the panel, display_config holds the canvas size while one is drawn
+        overlay_page = (uint8_t*)malloc(canvas_active ? canvas_saved.width : display_config.width);
+    }
+    if (overlay == NULL || overlay_page == NULL) {
+        return NULL;
+    }
+    
+    overlay->canvas.width = width;
+    overlay->canvas.height = height;
+    overlay->canvas.pages = (height + 7) / BITS_PER_BYTE;
+    overlay->canvas.buffer = (uint8_t*)calloc(overlay->canvas.pages, width);
+    if (overlay->canvas.buffer == NULL) {
+        return NULL;
+    }
+    overlay->x = x;
+    overlay->y = y;
+    overlay->priority = priority;
+    overlay->visible = false;
+    
+    // Insert after the overlays of lower or same priority
+    uint8_t position = overlay_count;
+    while (position > 0 && overlay_order[position - 1]->priority > priority) {
+        overlay_order[position] = overlay_order[position - 1];
+        position--;
+    }
+    overlay_order[position] = overlay;
+    overlay_count++;
+    
+    return overlay;
+#else
+    (void)x;
+    (void)y;
+    (void)width;
+    (void)height;
+    (void)priority;
+    return NULL;
+#endif //DISPLAY_OVERLAYS
+}
+
+/**
+ * Release the region of an overlay, the screen content below is shown again
+ */
+void display_overlay_remove(display_overlay_t* overlay) {
+#if DISPLAY_OVERLAYS
+    if (overlay == NULL || overlay->canvas.buffer == NULL) {
+        return;
+    }
+    
+    display_overlay_show(overlay, false);
+    for (uint8_t o = 0; o < overlay_count; o++) {
+        if (overlay_order[o] == overlay) {
+            memmove(&overlay_order[o], &overlay_order[o + 1], (overlay_count - o - 1) * sizeof(display_overlay_t*));
+            overlay_count--;
+            break;
+        }
+    }
+    free(overlay->canvas.buffer);
+    overlay->canvas.buffer = NULL;
+#if DISPLAY_GRAY
+    free(overlay->gray.buffer);
+    overlay->gray.buffer = NULL;
+#endif //DISPLAY_GRAY
+#else
+    (void)overlay;
+#endif //DISPLAY_OVERLAYS
+}
+
+/**
+ * Start drawing in an overlay: its region is cleared and all drawing functions
+ * draw in it until display_overlay_end(), with coordinates relative to the region
+ */
+bool display_overlay_begin(display_overlay_t* overlay) {
+#if DISPLAY_OVERLAYS
+    if (overlay == NULL || overlay->canvas.buffer == NULL) {
+        return false;
+    }
+    return display_canvas_begin(&overlay->canvas);
+#else
+    (void)overlay;
+    return false;
+#endif //DISPLAY_OVERLAYS
+}
+
+/**
+ * End drawing in an overlay, the changed part is sent to the display if the overlay is visible
+ */
+void display_overlay_end(display_overlay_t* overlay) {
+#if DISPLAY_OVERLAYS
+    display_canvas_end();
+    if (overlay != NULL && overlay->visible && !overlay_refresh_pending) {
+        overlay_refresh_pending = task_add_immediate(overlay_refresh_task, NULL);
+    }
+#else
+    (void)overlay;
+#endif //DISPLAY_OVERLAYS
+}
+
+/**
+ * Show or hide an overlay, the display is updated without waiting for the next screen
+ */
+void display_overlay_show(display_overlay_t* overlay, bool visible) {
+#if DISPLAY_OVERLAYS
+    if (overlay == NULL || overlay->canvas.buffer == NULL || overlay->visible == visible) {
+        return;
+    }
+    overlay->visible = visible;
+    if (!overlay_refresh_pending) {
+        overlay_refresh_pending = task_add_immediate(overlay_refresh_task, NULL);
+    }
+#if DISPLAY_GRAY
+    if (visible && overlay->gray.buffer) {
+        gray_start();
+    }
+#endif //DISPLAY_GRAY
+#else
+    (void)overlay;
+    (void)visible;
+#endif //DISPLAY_OVERLAYS
+}
+
+/**
+ * Give gray levels to an overlay, or remove them
+ * The overlay canvas is then the high bit of the pixel levels, and the low bit is drawn
+ * between display_overlay_begin_gray() and display_overlay_end(). While the overlay is
+ * visible, frames are alternated every DISPLAY_GRAY_INTERVAL ms and only the overlay
+ * region is sent. With 3 frames, a pixel lit in the gray plane only is at 33%, in the
+ * canvas only at 67%, in both at 100%. With 2 frames, a pixel lit in the gray plane
+ * only is at 50% and a pixel lit in the canvas is at 100%
+ * Returns false if gray levels are disabled (DISPLAY_GRAY) or not enough memory
+ */
+bool display_overlay_set_gray(display_overlay_t* overlay, bool gray) {
+#if DISPLAY_GRAY
+    if (overlay == NULL || overlay->canvas.buffer == NULL) {
+        return false;
+    }
+
+    if (!gray) {
+        free(overlay->gray.buffer);
+        overlay->gray.buffer = NULL;
+    } else if (overlay->gray.buffer == NULL) {
+        overlay->gray = overlay->canvas;
+        overlay->gray.buffer = (uint8_t*)calloc(overlay->canvas.pages, overlay->canvas.width);
+        if (overlay->gray.buffer == NULL) {
+            return false;
+        }
+        if (overlay->visible) {
+            gray_start();
+        }
+    }
+    if (overlay->visible && !overlay_refresh_pending) {
+        overlay_refresh_pending = task_add_immediate(overlay_refresh_task, NULL);
+    }
+    return true;
+#else
+    (void)overlay;
+    (void)gray;
+    return false;
+#endif //DISPLAY_GRAY
+}
+
+/**
+ * Start drawing the low bit of the pixel levels of a gray overlay, see display_overlay_begin()
+ */
+bool display_overlay_begin_gray(display_overlay_t* overlay) {
+#if DISPLAY_GRAY
+    if (overlay == NULL || overlay->gray.buffer == NULL) {
+        return false;
+    }
+    return display_canvas_begin(&overlay->gray);
+#else
+    (void)overlay;
+    return false;
+#endif //DISPLAY_GRAY
+}
+
+#if DISPLAY_OVERLAYS
+/**
+ * Send the overlay changes, only the changed spans are sent
+ */
+static void overlay_refresh_task(void* data) {
+    (void)data;
+    overlay_refresh_pending = false;
+    if (!canvas_active) {
+        display_refresh();
+    }
+}
+#endif //DISPLAY_OVERLAYS
+
+#if DISPLAY_GRAY
+/**
+ * Schedule the gray task if it is not running
+ */
+static void gray_start(void) {
+    if (!gray_running && disp_connected) {
+        gray_running = task_add_delayed(gray_task, NULL, DISPLAY_GRAY_INTERVAL);
+    }
+}
+
+/**
+ * Show the next frame of the gray cycle: only the changed part of the
+ * regions of visible gray overlays is sent, in a span for each page
+ * The phase is kept during fast moves (throttled display), while the bus is
+ * held or the display is off. The refresh listener is not called, mirrored
+ * frames show the gray pixels as they were at the last refresh
+ */
+static void gray_task(void* data) {
+    bool active = false;
+    (void)data;
+
+    gray_running = false;
+    for (uint8_t o = 0; o < overlay_count; o++) {
+        active |= overlay_order[o]->visible && overlay_order[o]->gray.buffer != NULL;
+    }
+    if (!active) {
+        // Back to the first frame, as drawn when there is no gray overlay
+        if (gray_phase != 0) {
+            gray_phase = 0;
+            display_refresh();
         }
-        
-        // Get character information
-        char_info_t char_info = get_char_info(font, c);
-        
-        // Check if we need to wrap
-        if (cursor_x + char_info.width > display_config.width) {
-            cursor_x = initial_x;
-            cursor_y += font_info.height + font_info.spacing;
-            
-            // Check if we've reached bottom of screen
-            if (cursor_y > display_config.height - font_info.height) {
-                break;
+        return;
+    }
+
+    if (display_power != DISPLAY_POWER_OFF && !bus_hold && !canvas_active && display_stats.throttle_level == 0) {
+        gray_phase = (gray_phase + 1) % DISPLAY_GRAY_FRAMES;
+        for (uint8_t o = 0; o < overlay_count; o++) {
+            const display_overlay_t* overlay = overlay_order[o];
+            if (!overlay->visible || overlay->gray.buffer == NULL) {
+                continue;
+            }
+
+            int16_t first_column = overlay->x < 0 ? 0 : overlay->x;
+            int16_t end_column = overlay->x + overlay->canvas.width;
+            int16_t first_page = overlay->y < 0 ? 0 : overlay->y / BITS_PER_BYTE;
+            int16_t end_page = (overlay->y + overlay->canvas.height + BITS_PER_BYTE - 1) / BITS_PER_BYTE;
+            if (end_column > display_config.width) {
+                end_column = display_config.width;
+            }
+            if (end_page > display_config.pages) {
+                end_page = display_config.pages;
+            }
+
+            for (int16_t page = first_page; page < end_page; page++) {
+                uint16_t offset = page * display_config.width;
+                const uint8_t* front = display_config.front_buffer + offset;
+                const uint8_t* back = display_compose_page(page);
+                int16_t first = first_column;
+                int16_t end = end_column;
+
+                while (first < end && front[first] == back[first]) {
+                    first++;
+                }
+                while (end > first && front[end - 1] == back[end - 1]) {
+                    end--;
+                }
+                if (first < end && display_send_at(page, first, back + first, end - first)) {
+                    memcpy(display_config.front_buffer + offset + first, back + first, end - first);
+                }
             }
         }
+        display_stats.gray_frames++;
+    }
+
+    gray_running = task_add_delayed(gray_task, NULL, DISPLAY_GRAY_INTERVAL);
+}
+#endif //DISPLAY_GRAY
+
+/**
+ * Refresh the screen
+ */
+bool display_refresh(void) {
+    bool success = true;
+    bool sent = false;
+    uint16_t budget = refresh_budget;
+    
+    // Nothing is sent to a display turned off, the front buffer keeps
+    // what it shows so only the changes are sent when it is turned on
+    if (display_power == DISPLAY_POWER_OFF) {
+        return true;
+    }
+    
+    // Another device holds the bus, the refresh is done when it is released
+    if (bus_hold) {
+        refresh_deferred = true;
+        display_stats.refresh_deferrals++;
+        return true;
+    }
+    refresh_deferred = false;
+    
+    // Compare with the front_buffer to detect differences
+    // and send only the changed columns of each page, unchanged areas
+    // like icons or static text are never sent again
+    for (uint8_t page = 0; page < display_config.pages; page++) {
+        const uint8_t* front = display_config.front_buffer + (page * display_config.width);
+        const uint8_t* back = display_compose_page(page);
+        int16_t column = 0;
         
-        // Skip rendering if completely off-screen
-        if (cursor_x + char_info.width < 0 || cursor_y + font_info.height < 0 || cursor_y >= display_config.height) {
-            cursor_x += char_info.width + font_info.spacing;
-            continue;
+        while (column < display_config.width) {
+            // Skip unchanged columns
+            if (front[column] == back[column]) {
+                column++;
+                continue;
+            }
+            
+            // Extend the span until enough unchanged columns are found
+            int16_t first = column;
+            int16_t last = column;
+            for (column++; column < display_config.width && column - last <= DISPLAY_REFRESH_SPAN_GAP; column++) {
+                if (front[column] != back[column]) {
+                    last = column;
+                }
+            }
+            int16_t length = last - first + 1;
+            
+            // Budget spent, the refresh task sends the rest from the next
+            // foreground loop, the front buffer tells what is left to send
+            if (refresh_budget && budget == 0) {
+                refresh_unfinished |= sent;
+                display_stats.refresh_deferrals++;
+                display_defer_refresh();
+                return success;
+            }
+            if (refresh_budget) {
+                if (length > budget) {
+                    length = budget;
+                }
+                budget -= length;
+            }
+            
+            success &= display_refresh_span(page, first, length);
+            column = first + length;
+            sent = true;
         }
-        
-        // Draw the character and advance cursor
-        int16_t char_width = display_draw_char(cursor_x, cursor_y, c, font);
-        cursor_x += char_width;
     }
     
-    // Return the width of the string (distance from initial x position)
-    return cursor_x - initial_x;
+    if ((sent || refresh_unfinished) && refresh_listener) {
+        refresh_listener(0, 0, 0, NULL);
+    }
+    refresh_unfinished = false;
+    
+    return success;
 }
 
 /**
- * Draw a string with the current font
+ * Schedule the refresh task to send the changes left by a refresh
  */
-int16_t display_draw_string(int16_t x, int16_t y, const char* text) {
-    if (text == NULL) return 0;
-    
-    // Use default font if none is set
-    if (current_font == NULL) {
-        current_font = display_config.display_small_font;
+static void display_defer_refresh(void) {
+    refresh_deferred = true;
+    if (!refresh_pending) {
+        refresh_pending = task_add_immediate(refresh_task, NULL);
+    }
+}
+
+/**
+ * Send the changes left by a deferred refresh
+ */
+static void refresh_task(void* data) {
+    (void)data;
+    refresh_pending = false;
+    if (refresh_deferred && !canvas_active) {
+        display_refresh();
     }
+}
 
-    // Convert to ASCII if text might be UTF-8
-    char* ascii_text = utf8_string_to_ascii(text);
+/**
+ * Set the function sending display transfers directly from their segments,
+ * for I2C drivers able to gather them, NULL to use the HAL and the staging buffer
+ */
+void display_set_transfer_handler(display_transfer_ptr handler) {
+    transfer_handler = handler;
+}
+
+/**
+ * Set the throttle level, each level halves the frame rate and the bytes sent by a refresh
+ * Level 0 restores the full rate
+ */
+void display_set_throttle(uint8_t level) {
+    if (level == display_stats.throttle_level) {
+        return;
+    }
+    display_stats.throttle_level = level;
+    display_stats.throttle_changes++;
+    throttle_frame = 0;
+    display_set_refresh_budget(refresh_budget_max);
+}
+
+/**
+ * Set the bytes sent by a refresh before the rest is left to the next foreground loop,
+ * 0 for no limit, the budget is divided at each throttle level
+ */
+void display_set_refresh_budget(uint16_t budget) {
+    refresh_budget_max = budget;
+    refresh_budget = budget >> display_stats.throttle_level;
+    if (budget && refresh_budget < 16) {
+        refresh_budget = 16;
+    }
+}
+
+/**
+ * Check if a frame must be skipped at the current throttle level,
+ * one frame out of 2^level is drawn
+ */
+bool display_throttled_frame(void) {
+    if (display_stats.throttle_level == 0) {
+        return false;
+    }
+    if (throttle_frame++ & ((1 << display_stats.throttle_level) - 1)) {
+        display_stats.throttled_frames++;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Send the contrast to the display
+ */
+static bool display_send_contrast(uint8_t contrast) {
+    bool success = display_send_command(0x81);
+    return display_send_command(contrast) && success;
+}
+
+/**
+ * Set the power state of the display
+ * The full contrast is restored when the display is turned off, so turning it on
+ * costs a single command, followed by the changes drawn while it was off
+ */
+bool display_set_power(display_power_t power) {
+    bool success = true;
     
-    // Calculate string dimensions
-    font_info_t font_info = get_font_info(current_font);
-    uint16_t text_width = get_string_width_with_font(ascii_text, strlen(ascii_text), current_font);
+    if (power == display_power) {
+        return true;
+    }
     
-    // Clear the area where the string will be drawn
+    switch (power) {
+        case DISPLAY_POWER_ON:
+            if (display_power == DISPLAY_POWER_DIM) {
+                success &= display_send_contrast(display_contrast);
+            }
+            break;
+        case DISPLAY_POWER_DIM:
+            success &= display_send_contrast(DISPLAY_DIM_CONTRAST);
+            break;
+        case DISPLAY_POWER_OFF:
+            success &= display_send_command(0xAE); // Display off
+            if (display_power == DISPLAY_POWER_DIM) {
+                success &= display_send_contrast(display_contrast);
+            }
+            break;
+    }
+    if (display_power == DISPLAY_POWER_OFF) {
+        success &= display_send_command(0xAF); // Display on
+    }
     
-    display_color_t original_color = current_fg_color;
-    display_set_color(current_bg_color);
-    display_fill_rect(x-1, y-1, text_width+2, font_info.height+2);
-    display_set_color(original_color);
-    // Draw the string
-    int16_t width = display_draw_string_with_font(x, y, ascii_text, current_font);
+    display_power = power;
+    display_stats.power_changes++;
     
-    // Free the allocated string if different from original
-    if (ascii_text != text) {
-        free(ascii_text);
+    // Send what changed while the display was off
+    if (power != DISPLAY_POWER_OFF && !canvas_active) {
+        success &= display_refresh();
     }
     
-    return width;
+    return success;
+}
+
+display_power_t display_get_power(void) {
+    return display_power;
 }
 
 /**
- * Get the width of a string with the specified font
+ * Set the contrast of the display when on, sent at once unless dimmed or off
  */
-uint16_t get_string_width_with_font(const char* text, uint16_t length, const char* font) {
-    if (text == NULL || length == 0 || font == NULL) return 0;
+bool display_set_contrast(uint8_t contrast) {
+    display_contrast = contrast;
+    return display_power == DISPLAY_POWER_ON ? display_send_contrast(contrast) : true;
+}
+
+/**
+ * Rotate the display by 180 degrees, or restore the orientation of the init sequence
+ */
+bool display_set_flipped(bool flipped) {
+    display_flipped = flipped;
+    bool success = display_send_command(flipped ? 0xA0 : 0xA1);   // Segment remap
+    return display_send_command(flipped ? 0xC0 : 0xC8) && success; // Com scan direction
+}
+
+/**
+ * Change the I2C address and the column offset of the display, the panel is initialized
+ * again with the current contrast, orientation and power state, then fully refreshed
+ */
+bool display_set_panel(uint8_t i2c_address, uint8_t column_offset) {
+    bool success = true;
     
-    uint16_t total_width = 0;
-    font_info_t font_info = get_font_info(font);
-    // Iterate through the text up to given length
-    for (uint16_t i = 0; i < length && text[i] != '\0'; i++) {
-        char c = text[i];
-        
-        // Handle newline character
-        if (c == '\n') {
-            break; // Width calculation assumes single line
-        }
-        
-        // Get character information
-        char_info_t char_info = get_char_info(font, c);
-        
-        // Add the character width to the total
-        total_width += char_info.width +  font_info.spacing;
+    display_config.i2c_address = i2c_address;
+    display_config.column_offset = column_offset;
+    i2c_data.address = i2c_address;
+    
+    if (display_config.front_buffer == NULL || disp_virtual) {
+        return true;
+    }
+    if (!(disp_connected = i2c_probe(i2c_address))) {
+        return false;
     }
     
-    // Remove the last character spacing if there was at least one character
-    if (total_width > 0 && length > 0) {
-        total_width -=  font_info.spacing;
+    for (uint8_t i = 0; success && i < display_config.init_sequence_length; i++) {
+        success &= display_send_command(display_config.init_sequence[i]);
+    }
+    if (display_contrast != DISPLAY_CONTRAST) {
+        success &= display_send_contrast(display_contrast);
+    }
+    if (display_flipped) {
+        success &= display_set_flipped(true);
+    }
+    if (display_power != DISPLAY_POWER_ON) {
+        display_power_t power = display_power;
+        display_power = DISPLAY_POWER_ON;
+        success &= display_set_power(power);
     }
     
-    return total_width;
+    // The panel memory is unknown, every column is sent again
+    for (uint16_t i = 0; i < display_config.buffer_size; i++) {
+        display_config.front_buffer[i] = ~display_config.back_buffer[i];
+    }
+    return display_refresh() && success;
 }
 
 /**
- * Get the width of a string with current font
+ * Hold the bus for another device, refreshes are deferred until it is released
+ * Holds can be nested, each hold must be released
  */
-uint16_t get_string_width(const char* text) {
-    if (text == NULL) return 0;
+void display_hold_bus(bool hold) {
+    if (hold) {
+        bus_hold++;
+    } else if (bus_hold > 0) {
+        bus_hold--;
+        if (bus_hold == 0 && refresh_deferred) {
+            display_defer_refresh();
+        }
+    }
+}
+
+/**
+ * Send a span of a page of the back buffer to the display
+ */
+bool display_refresh_span(uint8_t page, uint8_t column, uint8_t length) {
+    bool success = true;
+    uint16_t offset = (page * display_config.width) + column;
     
-    // Use default font if none is set
-    if (current_font == NULL) {
-        current_font = display_config.display_small_font;
+    if (page >= display_config.pages || column >= display_config.width || length == 0) {
+        return false;
+    }
+    if (column + length > display_config.width) {
+        length = display_config.width - column;
     }
+    const uint8_t* data = display_compose_page(page) + column;
     
-    return get_string_width_with_font(text, strlen(text), current_font);
+    // Send the data at the page and column
+    success &= display_send_at(page, column, data, length);
+    
+    // if success, copy the span to the front_buffer
+    if (success) {
+        memcpy(display_config.front_buffer + offset, data, length);
+        if (refresh_listener) {
+            refresh_listener(page, column, length, display_config.front_buffer + offset);
+        }
+    }
+    
+    return success;
 }
 
 /**
- * Refresh the screen
+ * Draw the next frame of the animation and schedule the following one
  */
-bool display_refresh(void) {
-    bool success = true;
+static void animation_task(void* data) {
+    animation_player_t* player = &animation_player;
+    const uint8_t* animation = player->animation;
+    (void)data;
     
-    // Compare with the front_buffer to detect differences
-    bool pages_changed[8] = {false}; // Max 8 pages
-    bool any_change = false;
+    if (animation == NULL) {
+        return;
+    }
     
-    for (uint8_t page = 0; page < display_config.pages; page++) {
-        // Check if the page has changed
-        if (memcmp(display_config.front_buffer + (page * display_config.width), 
-                  display_config.back_buffer + (page * display_config.width), 
-                  display_config.width) != 0) {
-            pages_changed[page] = true;
-            any_change = true;
+    uint8_t width = pgm_read_byte(&animation[0]);
+    uint8_t frames = pgm_read_byte(&animation[2]);
+    uint8_t delay = pgm_read_byte(&animation[3]);
+    
+    // Apply the delta spans of the frame to the back buffer, the refresh sends
+    // them unless the display is off or the bus is held, within the byte budget
+    uint8_t spans = pgm_read_byte(&animation[player->position++]);
+    for (uint8_t i = 0; i < spans; i++) {
+        uint8_t page = player->page + pgm_read_byte(&animation[player->position]);
+        int16_t column = player->x + pgm_read_byte(&animation[player->position + 1]);
+        uint8_t length = pgm_read_byte(&animation[player->position + 2]);
+        const uint8_t* bytes = &animation[player->position + ANIMATION_SPAN_HEADER_SIZE];
+        player->position += ANIMATION_SPAN_HEADER_SIZE + length;
+        
+        // Clip the span to the display
+        if (page >= display_config.pages) {
+            continue;
+        }
+        if (column < 0) {
+            bytes -= column;
+            length = (-column < length) ? length + column : 0;
+            column = 0;
+        }
+        if (column + length > display_config.width) {
+            length = (column < display_config.width) ? display_config.width - column : 0;
+        }
+        if (length == 0) {
+            continue;
+        }
+        
+        uint8_t* buffer = display_config.back_buffer + (page * display_config.width) + column;
+        for (uint8_t j = 0; j < length; j++) {
+            buffer[j] = pgm_read_byte(&bytes[j]);
+        }
+    }
+    display_refresh();
+    
+    // Schedule the next frame, going back to the first delta when the animation is over
+    if (++player->frame >= frames) {
+        if (--player->repeat == 0) {
+            player->animation = NULL;
+            return;
         }
+        player->frame = 1;
+        player->position = ANIMATION_HEADER_SIZE + (width * ((pgm_read_byte(&animation[1]) + 7) / BITS_PER_BYTE));
     }
+    task_add_delayed(animation_task, NULL, delay * 10);
+}
 
-    // if no change, do nothing
-    if (!any_change) {
-        return true;
+/**
+ * Play an animation (see png_converter.py --animation) with its top left corner at column x of page
+ * The key frame is drawn in the back buffer, then each frame delta is applied to the
+ * back buffer and refreshed, so only the changed spans are sent, from a delayed task
+ * If repeat is more than 1, the animation must end on its key frame (--loop option)
+ */
+bool display_play_animation(const uint8_t* animation, int16_t x, uint8_t page, uint8_t repeat) {
+    if (animation == NULL || display_config.back_buffer == NULL || repeat == 0) {
+        return false;
     }
     
-    // Update only the pages that have changed
-    for (uint8_t page = 0; page < display_config.pages; page++) {
-        if (pages_changed[page]) {
-            // Set the page
-            success &= display_send_command(0xB0 | page);
-            
-            // Reset the column
-            success &= display_send_command(0x00 | SHIFT_COMMAND_1);        // Set lower column start address
-            success &= display_send_command(0x10 | SHIFT_COMMAND_2);
-            
-            // Send the data
-            success &= display_send_data(display_config.back_buffer + (page * display_config.width), display_config.width);
+    uint8_t width = pgm_read_byte(&animation[0]);
+    uint8_t pages = (pgm_read_byte(&animation[1]) + 7) / BITS_PER_BYTE;
+    uint8_t frames = pgm_read_byte(&animation[2]);
+    
+    // Draw the key frame
+    for (uint8_t p = 0; p < pages && page + p < display_config.pages; p++) {
+        for (uint8_t i = 0; i < width; i++) {
+            if (x + i >= 0 && x + i < display_config.width) {
+                display_config.back_buffer[((page + p) * display_config.width) + x + i] = pgm_read_byte(&animation[ANIMATION_HEADER_SIZE + (p * width) + i]);
+            }
         }
     }
     
-    // if success, copy the display_config.back_buffer to the front_buffer
-    if (success) {
-        memcpy(display_config.front_buffer, display_config.back_buffer, display_config.buffer_size);
+    animation_player.animation = animation;
+    animation_player.position = ANIMATION_HEADER_SIZE + (width * pages);
+    animation_player.frame = 1;
+    animation_player.repeat = repeat;
+    animation_player.x = x;
+    animation_player.page = page;
+    
+    if (frames > 1) {
+        task_add_delayed(animation_task, NULL, pgm_read_byte(&animation[3]) * 10);
+    } else {
+        animation_player.animation = NULL;
     }
     
-    return success;
+    return true;
+}
+
+/**
+ * Check if an animation is playing
+ */
+bool display_animation_playing(void) {
+    return animation_player.animation != NULL;
 }
 
 /**
@@ -770,25 +3488,41 @@ bool display_clear_immediate(void) {
     
     // Clear the physical screen
     for (uint8_t page = 0; page < display_config.pages; page++) {
-        // Set the page
-        success &= display_send_command(0xB0 | page);
-        
-        // Reset the column
-        success &= display_send_command(0x00 | SHIFT_COMMAND_1);        // Set lower column start address
-        success &= display_send_command(0x10 | SHIFT_COMMAND_2);
-        
-        // Send the data to clear the page
-        success &= display_send_data(display_config.back_buffer + (page * display_config.width), display_config.width);
+        // Send the data to clear the page from the first column
+        success &= display_send_at(page, 0, display_config.back_buffer + (page * display_config.width), display_config.width);
     }
     
     // Update the front buffer as well
     if (success) {
         memset(display_config.front_buffer, 0, display_config.buffer_size);
+        display_replay_frame();
     }
     
     return success;
 }
 
+/**
+ * Set the function called with each span sent to the display and
+ * with a length of 0 once a refresh is complete, NULL to remove it
+ */
+void display_set_refresh_listener(display_refresh_listener_ptr listener) {
+    refresh_listener = listener;
+}
+
+/**
+ * Send the whole display content to the refresh listener, a page at a time
+ */
+void display_replay_frame(void) {
+    if (refresh_listener == NULL || display_config.front_buffer == NULL) {
+        return;
+    }
+    
+    for (uint8_t page = 0; page < display_config.pages; page++) {
+        refresh_listener(page, 0, display_config.width, display_config.front_buffer + (page * display_config.width));
+    }
+    refresh_listener(0, 0, 0, NULL);
+}
+
 /**
  * Initialize the display hardware
  */
@@ -807,8 +3541,15 @@ bool display_oled_init(void) {
     }
     i2c_cap_t cap = i2c_start();
     // Check if display is connected
-    if (cap.started && i2c_probe(display_config.i2c_address)) {
-        disp_connected = true;
+    disp_connected = cap.started && i2c_probe(display_config.i2c_address);
+#if DISPLAY_VIRTUAL
+    // Without panel, draw in the RAM buffers only
+    if (!disp_connected) {
+        report_warning("Display not connected, using a virtual display");
+        disp_virtual = true;
+    }
+#endif //DISPLAY_VIRTUAL
+    if (disp_connected || disp_virtual) {
         // Send initialization sequence
         for (uint8_t i = 0; i < display_config.init_sequence_length; i++) {
             // Send the command
@@ -837,9 +3578,24 @@ bool display_oled_init(void) {
         if (success) {
             if ((success = display_clear())) {
                 
-                // Draw welcome screen
+                // Draw welcome screen, boot animation, logo file, then compiled logo if any
+                bool logo_drawn = false;
+                uint16_t logo_width, logo_height;
                 display_draw_rect(0, 0, display_config.width, display_config.height); 
-                display_draw_xbm((display_config.width - display_config.logo_width)/2, (display_config.height - display_config.logo_height)/2, display_config.logo_width, display_config.logo_height, display_config.logo_bits); 
+#if DISPLAY_BOOT_ANIMATION
+                logo_drawn = display_play_animation(boot_animation, (display_config.width - pgm_read_byte(&boot_animation[0]))/2,
+                                                    (display_config.pages - ((pgm_read_byte(&boot_animation[1]) + 7) / BITS_PER_BYTE))/2, DISPLAY_BOOT_ANIMATION_REPEAT);
+#endif //DISPLAY_BOOT_ANIMATION
+                if (!logo_drawn && display_get_image_file_size(DISPLAY_LOGO_FILE, &logo_width, &logo_height)) {
+                    logo_drawn = display_draw_image_file((display_config.width - logo_width)/2, (display_config.height - logo_height)/2, DISPLAY_LOGO_FILE);
+                }
+                if (!logo_drawn && display_config.logo_bits) {
+                    display_draw_xbm((display_config.width - display_config.logo_width)/2, (display_config.height - display_config.logo_height)/2, display_config.logo_width, display_config.logo_height, display_config.logo_bits); 
+                }
+                // The panel memory is unknown at power up, every column is sent with the first frame
+                for (uint16_t i = 0; i < display_config.buffer_size; i++) {
+                    display_config.front_buffer[i] = ~display_config.back_buffer[i];
+                }
                 display_refresh();
             } else {
                 report_warning("Failed to clear display");
@@ -854,11 +3610,26 @@ bool display_oled_init(void) {
 }
 
 
+// give display statistics
+const display_stats_t * display_get_stats(void){
+    return &display_stats;
+}
+
 // give status of display
 bool display_connected(){
     return disp_connected;
 }
 
+// give if the display is virtual (no panel, DISPLAY_VIRTUAL)
+bool display_virtual(void){
+    return disp_virtual;
+}
+
+// give if the frames are used, by the panel or by the refresh listener
+bool display_has_consumer(void){
+    return disp_connected || refresh_listener != NULL;
+}
+
 const char * display_name(void){
     return display_config.name;
 }
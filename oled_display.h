@@ -31,6 +31,25 @@
 // Types and Constants
 // --------------------------------------------------------
 
+// Panel sizes of the SSD1306 driver, the SH1106 driver is 128 x 64 only
+#define DISPLAY_PANEL_128X64 0
+#define DISPLAY_PANEL_128X32 1
+#define DISPLAY_PANEL_72X40 2
+
+#ifndef DISPLAY_PANEL
+#define DISPLAY_PANEL DISPLAY_PANEL_128X64
+#endif //DISPLAY_PANEL
+
+// Maximum data bytes sent by a refresh before returning to the foreground loop, the rest is sent by an immediate task, 0 for no limit
+#ifndef DISPLAY_REFRESH_BUDGET
+#define DISPLAY_REFRESH_BUDGET 256
+#endif //DISPLAY_REFRESH_BUDGET
+
+// Contrast of the display when on, as set by the init sequence
+#ifndef DISPLAY_CONTRAST
+#define DISPLAY_CONTRAST 0xCF
+#endif //DISPLAY_CONTRAST
+
 /**
  * Display color enumeration
  */
@@ -46,6 +65,20 @@ typedef enum {
   DISPLAY_FONT_BIG
 } display_font_size_t;
 
+// Alignment of the strings drawn by display_draw_strings
+typedef enum {
+  DISPLAY_ALIGN_LEFT,   // x is the left edge
+  DISPLAY_ALIGN_RIGHT,  // x is the right edge (excluded)
+  DISPLAY_ALIGN_CENTER  // x is the center
+} display_align_t;
+
+// Display power states
+typedef enum {
+  DISPLAY_POWER_ON,   // Full contrast
+  DISPLAY_POWER_DIM,  // Contrast lowered to DISPLAY_DIM_CONTRAST
+  DISPLAY_POWER_OFF   // Panel off, nothing is sent until it is turned on
+} display_power_t;
+
 // Define display configuration structure
 typedef struct  {
   const char * name;
@@ -58,6 +91,7 @@ typedef struct  {
   uint16_t buffer_size;
   uint8_t command_head;
   uint8_t data_head;
+  uint8_t column_offset; // First column of the panel in the controller memory
   uint8_t init_sequence_length;
   uint8_t * init_sequence; 
   const char* display_small_font;
@@ -69,6 +103,85 @@ typedef struct  {
   const char * logo_bits;
 } display_config_t;
 
+// Display statistics counters
+typedef struct {
+  uint32_t glyph_cache_hits;   // Glyphs drawn from the RAM glyph cache
+  uint32_t glyph_cache_misses; // Glyphs decoded from font into the RAM glyph cache
+  uint32_t text_row_glyphs;    // Glyphs drawn from the text rows declared by the layout
+  uint32_t stroke_cache_hits;  // Stroke strings copied from the RAM stroke cache
+  uint32_t stroke_cache_misses; // Stroke strings drawn into the RAM stroke cache
+  uint32_t text_cache_hits;    // Strings copied from the RAM text cache
+  uint32_t text_cache_misses;  // Strings drawn into the RAM text cache
+  uint32_t i2c_transactions;   // I2C transactions sent to the display, commands and data
+  uint32_t i2c_data_bytes;     // Display memory bytes sent to the display
+  uint32_t refresh_deferrals;  // Refreshes left unfinished for the bus budget or a bus hold
+  uint32_t i2c_staged_bytes;   // Bytes copied in the staging buffer for transfers without transfer handler
+  uint32_t throttle_changes;   // Changes of the throttle level
+  uint32_t throttled_frames;   // Frames skipped by the throttle
+  uint32_t power_changes;      // Changes of the power state
+  uint32_t gray_frames;        // Frames of the gray cycle sent for gray overlays
+  uint8_t throttle_level;      // Current throttle level, 0 at full rate
+} display_stats_t;
+
+// Segments of a display transfer
+#ifndef DISPLAY_TRANSFER_SEGMENTS
+#define DISPLAY_TRANSFER_SEGMENTS 2
+#endif //DISPLAY_TRANSFER_SEGMENTS
+
+// Part of a display transfer, data is not copied
+typedef struct {
+  const uint8_t * data;
+  uint16_t length;
+} display_segment_t;
+
+// Display write: the control byte then the segments, in a single I2C transaction
+typedef struct {
+  uint8_t address;  // I2C address of the display
+  uint8_t control;  // Control byte, command_head or data_head
+  uint8_t count;    // Segments used
+  display_segment_t segments[DISPLAY_TRANSFER_SEGMENTS];
+} display_transfer_t;
+
+// Sends a display transfer as one transaction, directly from the segments
+typedef bool (*display_transfer_ptr)(const display_transfer_t* transfer);
+
+// Drawing surface in the display memory layout (page-major, bit 0 is the top pixel)
+typedef struct {
+  uint8_t width;
+  uint8_t height;
+  uint8_t pages;
+  uint8_t * buffer; // width x pages bytes
+} display_canvas_t;
+
+// Fonts and y phases of the text rows declared by display_prepare_text_row, 0 to disable
+#ifndef DISPLAY_TEXT_ROWS
+#define DISPLAY_TEXT_ROWS 8
+#endif //DISPLAY_TEXT_ROWS
+
+// Strings sorted together by display_draw_strings, more are drawn in batches, a 128 x 64 layout of 6 axes draws 20
+#ifndef DISPLAY_STRINGS_MAX
+#define DISPLAY_STRINGS_MAX 24
+#endif //DISPLAY_STRINGS_MAX
+
+// String drawn by display_draw_strings
+typedef struct {
+  int16_t x;          // See align
+  int16_t y;          // Top
+  uint8_t align;      // display_align_t
+  uint8_t font;       // display_font_size_t
+  uint8_t color;      // display_color_t
+  const char * text;  // NULL to skip the string
+  int16_t left;       // Left edge, set when drawn
+  uint16_t width;     // Width, set when drawn
+} display_string_t;
+
+// Screen region reserved by another plugin (see display_overlay_add)
+typedef struct display_overlay display_overlay_t;
+
+// Called with each span sent to the display (data is the span in the display memory layout),
+// and with a length of 0 once a refresh is complete
+typedef void (*display_refresh_listener_ptr)(uint8_t page, uint8_t column, uint8_t length, const uint8_t* data);
+
 // Global variables
 extern display_config_t display_config;
 
@@ -79,21 +192,60 @@ bool display_oled_init(void);
 void display_set_color(display_color_t color);
 void display_set_pixel(int16_t x, int16_t y);
 void display_set_font(display_font_size_t font_size);
+bool display_load_font(display_font_size_t font_size, const char* path);
 void display_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
 void display_draw_rect(int16_t x, int16_t y, int16_t width, int16_t height);
 void display_fill_rect(int16_t x, int16_t y, int16_t width, int16_t height);
+void display_invert_rect(int16_t x, int16_t y, int16_t width, int16_t height);
 void display_draw_circle(int16_t x0, int16_t y0, int16_t radius);
 void display_fill_circle(int16_t x0, int16_t y0, int16_t radius);
 void display_draw_xbm(int16_t x, int16_t y, int16_t width, int16_t height, const char *xbm);
+bool display_draw_image_file(int16_t x, int16_t y, const char* path);
+void display_draw_icon(int16_t x, int16_t y, const uint8_t* sheet, uint8_t id);
+uint8_t display_get_icon_width(const uint8_t* sheet, uint8_t id);
+bool display_get_image_file_size(const char* path, uint16_t* width, uint16_t* height);
 int16_t display_draw_char(int16_t x, int16_t y, char c, const char* font);
 int16_t display_draw_string_with_font(int16_t x, int16_t y, const char* text, const char* font);
 int16_t display_draw_string(int16_t x, int16_t y, const char* text);
+void display_draw_strings(display_string_t * strings, uint8_t count);
 uint16_t get_string_width_with_font(const char* text, uint16_t length, const char* font);
 uint16_t get_string_width(const char* text);
 uint16_t get_font_height();
+uint16_t get_font_height_with_font(const char* font);
+int16_t display_draw_stroke_string(int16_t x, int16_t y, const char* text, uint8_t height);
+uint16_t get_stroke_string_width(const char* text, uint8_t height);
+bool display_canvas_begin(display_canvas_t* canvas);
+void display_canvas_end(void);
+void display_draw_canvas(int16_t x, int16_t y, const display_canvas_t* canvas);
+display_overlay_t * display_overlay_add(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t priority);
+void display_overlay_remove(display_overlay_t * overlay);
+bool display_overlay_begin(display_overlay_t * overlay);
+void display_overlay_end(display_overlay_t * overlay);
+void display_overlay_show(display_overlay_t * overlay, bool visible);
+bool display_overlay_set_gray(display_overlay_t * overlay, bool gray);
+bool display_overlay_begin_gray(display_overlay_t * overlay);
+bool display_prepare_text_row(display_font_size_t font_size, int16_t y, const char* chars);
 bool display_refresh(void);
+bool display_refresh_span(uint8_t page, uint8_t column, uint8_t length);
+void display_hold_bus(bool hold);
+void display_set_throttle(uint8_t level);
+bool display_throttled_frame(void);
+bool display_set_power(display_power_t power);
+display_power_t display_get_power(void);
+bool display_set_contrast(uint8_t contrast);
+bool display_set_flipped(bool flipped);
+bool display_set_panel(uint8_t i2c_address, uint8_t column_offset);
+void display_set_refresh_budget(uint16_t budget);
+void display_set_transfer_handler(display_transfer_ptr handler);
+void display_set_refresh_listener(display_refresh_listener_ptr listener);
+void display_replay_frame(void);
+bool display_play_animation(const uint8_t* animation, int16_t x, uint8_t page, uint8_t repeat);
+bool display_animation_playing(void);
 bool display_clear(void);
 bool display_clear_immediate(void);
-bool display_connected(void);\
+bool display_connected(void);
+bool display_virtual(void);
+bool display_has_consumer(void);
 const char * display_name(void);
+const display_stats_t * display_get_stats(void);
 
@@ -30,6 +30,7 @@
 
 // Include according to the display type
 #include "oled_display.h"
+#include "./images/icons.h"
 
 #if ETHERNET_ENABLE || WIFI_ENABLE
 #ifdef ARDUINO
@@ -46,6 +47,86 @@ extern char const *const axis_letter[N_AXIS];
 #define PLUGGIN_DISPLAY_VERSION "1.0.0"
 // Define polling delay
 #define POLLING_DELAY 800
+// Define directory of font files replacing the compiled fonts (DISPLAY_FONT_FILES)
+#ifndef DISPLAY_FONT_FILES_PATH
+#define DISPLAY_FONT_FILES_PATH "/oled/"
+#endif //DISPLAY_FONT_FILES_PATH
+// Mirror the display changes to the stream subscribed with $OLEDMIRROR
+#ifndef DISPLAY_MIRROR
+#define DISPLAY_MIRROR 0
+#endif //DISPLAY_MIRROR
+// Stream the display content as a compressed PBM image with $OLEDSHOT
+#ifndef DISPLAY_SCREENSHOT
+#define DISPLAY_SCREENSHOT 0
+#endif //DISPLAY_SCREENSHOT
+// Compressed bytes written by each screenshot record
+#ifndef DISPLAY_SCREENSHOT_CHUNK
+#define DISPLAY_SCREENSHOT_CHUNK 48
+#endif //DISPLAY_SCREENSHOT_CHUNK
+// Step rate (steps/s of the axis with the most steps per mm) from which the display is throttled, 0 to never throttle
+#ifndef DISPLAY_THROTTLE_STEP_RATE
+#define DISPLAY_THROTTLE_STEP_RATE 20000
+#endif //DISPLAY_THROTTLE_STEP_RATE
+// Throttle levels, a level is added at each doubling of the step rate
+#ifndef DISPLAY_THROTTLE_LEVELS
+#define DISPLAY_THROTTLE_LEVELS 2
+#endif //DISPLAY_THROTTLE_LEVELS
+// Idle time in seconds before the display is dimmed, 0 to never dim
+#ifndef DISPLAY_DIM_TIMEOUT
+#define DISPLAY_DIM_TIMEOUT 0
+#endif //DISPLAY_DIM_TIMEOUT
+// Idle time in seconds before the display is turned off, 0 to only turn it off in sleep state
+#ifndef DISPLAY_OFF_TIMEOUT
+#define DISPLAY_OFF_TIMEOUT 0
+#endif //DISPLAY_OFF_TIMEOUT
+// Register $ settings to tune the display without reflashing
+#ifndef DISPLAY_SETTINGS
+#define DISPLAY_SETTINGS 1
+#endif //DISPLAY_SETTINGS
+// First setting id, 7 ids are used
+#ifndef DISPLAY_SETTINGS_ID
+#define DISPLAY_SETTINGS_ID Setting_UserDefined_0
+#endif //DISPLAY_SETTINGS_ID
+// Default I2C address of the display
+#ifndef DISPLAY_I2C_ADDRESS
+#define DISPLAY_I2C_ADDRESS 0x3C
+#endif //DISPLAY_I2C_ADDRESS
+// On-device menu (coordinate system, units, contrast, orientation) driven by buttons
+// or a rotary encoder on auxiliary inputs
+#ifndef DISPLAY_MENU
+#define DISPLAY_MENU 0
+#endif //DISPLAY_MENU
+// Rotary encoder instead of up and down buttons: the up port is phase A, the down port phase B
+#ifndef DISPLAY_MENU_ENCODER
+#define DISPLAY_MENU_ENCODER 0
+#endif //DISPLAY_MENU_ENCODER
+// Auxiliary input ports of the menu, inputs are active low
+#ifndef DISPLAY_MENU_PORT_UP
+#define DISPLAY_MENU_PORT_UP 0
+#endif //DISPLAY_MENU_PORT_UP
+#ifndef DISPLAY_MENU_PORT_DOWN
+#define DISPLAY_MENU_PORT_DOWN 1
+#endif //DISPLAY_MENU_PORT_DOWN
+#ifndef DISPLAY_MENU_PORT_SELECT
+#define DISPLAY_MENU_PORT_SELECT 2
+#endif //DISPLAY_MENU_PORT_SELECT
+// Edges of an input ignored after an accepted one in ms, lower it for encoders
+#ifndef DISPLAY_MENU_DEBOUNCE
+#define DISPLAY_MENU_DEBOUNCE 30
+#endif //DISPLAY_MENU_DEBOUNCE
+// Delay without input before the menu is closed in seconds
+#ifndef DISPLAY_MENU_TIMEOUT
+#define DISPLAY_MENU_TIMEOUT 30
+#endif //DISPLAY_MENU_TIMEOUT
+
+#if DISPLAY_SETTINGS
+#include "grbl/nvs_buffer.h"
+#endif //DISPLAY_SETTINGS
+#if DISPLAY_MENU
+#include "grbl/ioports.h"
+#include "grbl/gcode.h"
+#include "grbl/state_machine.h"
+#endif //DISPLAY_MENU
 
 
 // --------------------------------------------------------
@@ -53,6 +134,135 @@ extern char const *const axis_letter[N_AXIS];
 // --------------------------------------------------------
 
 
+#if DISPLAY_SCREENSHOT
+// Screenshot being written to the stream
+typedef struct {
+    uint8_t *snapshot;      // Copy of the display buffer, NULL if no screenshot is being written
+    char header[16];        // PBM header
+    uint8_t header_size;    // PBM header length
+    uint16_t size;          // PBM file size
+    uint16_t position;      // Next PBM byte to compress
+    uint16_t written;       // Compressed bytes written
+    stream_write_ptr write; // Write function of the stream requesting the screenshot
+} screenshot_t;
+#endif //DISPLAY_SCREENSHOT
+
+#if DISPLAY_SETTINGS
+// Settings stored in NVS
+typedef struct {
+    uint16_t refresh_interval; // Polling delay in ms
+    uint8_t i2c_address;
+    uint8_t driver;            // Index in display_drivers
+    uint8_t flipped;           // Display rotated by 180 degrees
+    uint8_t contrast;
+    uint16_t refresh_budget;   // Bytes sent by a refresh before the rest is left to the next foreground loop
+    uint8_t layout;            // Optional layout fields shown, LAYOUT_SHOW_* bits
+} display_settings_t;
+
+// Settings ids
+#define Setting_DisplayRefreshInterval (setting_id_t)(DISPLAY_SETTINGS_ID)
+#define Setting_DisplayI2CAddress      (setting_id_t)(DISPLAY_SETTINGS_ID + 1)
+#define Setting_DisplayDriver          (setting_id_t)(DISPLAY_SETTINGS_ID + 2)
+#define Setting_DisplayFlipped         (setting_id_t)(DISPLAY_SETTINGS_ID + 3)
+#define Setting_DisplayContrast        (setting_id_t)(DISPLAY_SETTINGS_ID + 4)
+#define Setting_DisplayRefreshBudget   (setting_id_t)(DISPLAY_SETTINGS_ID + 5)
+#define Setting_DisplayLayout          (setting_id_t)(DISPLAY_SETTINGS_ID + 6)
+
+// Layout setting bits, in the order of the bitfield format
+#define LAYOUT_SHOW_IP       0x01
+#define LAYOUT_SHOW_ICONS    0x02
+#define LAYOUT_SHOW_ENDSTOPS 0x04
+#define LAYOUT_SHOW_ALL      0x07
+#endif //DISPLAY_SETTINGS
+
+#if DISPLAY_MENU
+// Menu inputs
+typedef enum {
+    MENU_INPUT_UP = 0,      // Encoder phase A
+    MENU_INPUT_DOWN,        // Encoder phase B
+    MENU_INPUT_SELECT,
+    MENU_INPUTS
+} menu_input_t;
+
+// Menu entries
+typedef enum {
+    MENU_WCS = 0,       // Work coordinate system, changed in Idle state only
+    MENU_UNITS,         // Report units setting ($13)
+    MENU_CONTRAST,
+    MENU_FLIP,
+    MENU_EXIT,
+    MENU_ENTRIES
+} menu_entry_t;
+
+// Menu state, the inputs are recorded by the interrupts and handled by menu_task
+typedef struct {
+    bool open;
+    uint8_t selected;                   // Highlighted entry
+    uint8_t top;                        // First entry shown
+    uint8_t contrast;
+    bool flipped;
+    uint32_t ticks;                     // Ticks of the last input handled
+    uint8_t ports[MENU_INPUTS];         // Claimed auxiliary input ports
+    uint32_t edge_ticks[MENU_INPUTS];   // Ticks of the last accepted edge of each input
+    volatile int8_t steps;              // Highlight moves not handled yet, positive downwards
+    volatile bool select;               // Select pressed and not handled yet
+    volatile bool pending;              // menu_task is scheduled
+} menu_t;
+#endif //DISPLAY_MENU
+
+// Layout field types
+typedef enum {
+    LAYOUT_STATE = 0,   // Machine state
+    LAYOUT_IP,          // IP address, hidden without network
+    LAYOUT_LABEL,       // Axis label
+    LAYOUT_POSITION,    // Axis position
+    LAYOUT_ICONS,       // Status icons, drawn while there is room left
+    LAYOUT_FILL,        // Filled rectangle
+    LAYOUT_ENDSTOP      // Endstop box, filled when triggered
+} layout_type_t;
+
+// Layout field alignments
+typedef enum {
+    LAYOUT_ALIGN_LEFT = 0,  // x is the left edge
+    LAYOUT_ALIGN_RIGHT,     // x is the right edge (excluded)
+    LAYOUT_ALIGN_AFTER      // x is the gap after the right edge of the field 'after'
+} layout_align_t;
+
+// Layout field flags
+#define LAYOUT_ENDSTOP_ONLY 0x01    // Hidden when the endstop of the axis is not reporting
+#define LAYOUT_FONT_HEIGHT  0x02    // The font height is added to the height
+// No field
+#define LAYOUT_NONE 0xFF
+// Position of fields whose content width changes
+#define LAYOUT_X_DYNAMIC INT16_MIN
+
+// Field of a layout, layouts are generated by tools/layout_generator.py
+typedef struct {
+    uint8_t type;       // layout_type_t
+    uint8_t flags;
+    uint8_t axis;       // Axis of labels, positions and endstops
+    uint8_t font;       // display_font_size_t
+    uint8_t color;      // display_color_t
+    uint8_t align;      // layout_align_t
+    uint8_t after;      // Field x is relative to with LAYOUT_ALIGN_AFTER
+    uint8_t before;     // Field bounding the icons on the right, LAYOUT_NONE for the display edge
+    int16_t x;
+    int16_t y;          // Top, 'line' times the font height is added
+    uint8_t line;
+    uint8_t width;      // Width of rectangles, margin kept before the field 'before' for icons
+    int8_t height;      // Height of rectangles, added to the font height with LAYOUT_FONT_HEIGHT
+} layout_field_t;
+
+#if DISPLAY_PANEL == DISPLAY_PANEL_128X32
+#include "./layouts/layout_128x32.h"
+#elif DISPLAY_PANEL == DISPLAY_PANEL_72X40
+#include "./layouts/layout_72x40.h"
+#else
+#include "./layouts/layout_128x64.h"
+#endif //DISPLAY_PANEL
+
+#define LAYOUT_FIELDS (sizeof(layout_fields) / sizeof(layout_field_t))
+
 // Define data to display
 typedef struct {
     const char *state;
@@ -62,17 +272,45 @@ typedef struct {
     char pos_str[N_AXIS][STRLEN_COORDVALUE + 1];
     char label[N_AXIS][3];
     int8_t end_stop[N_AXIS];
+    bool spindle_on;
+    bool coolant_on;
+    bool locked;
 } oled_screen_data_t;
 
 // Global variables
 static on_report_options_ptr on_report_options;
 static on_state_change_ptr on_state_change;
 static oled_screen_data_t screen1;
+static int16_t layout_x[LAYOUT_FIELDS];      // Left edge of the fields of fixed width, LAYOUT_X_DYNAMIC for others
+static uint8_t layout_width[LAYOUT_FIELDS];  // Width of the fields of fixed width
 
 #if ETHERNET_ENABLE || WIFI_ENABLE
 static on_network_event_ptr on_event;
 #endif
 
+static uint16_t polling_delay = POLLING_DELAY;
+static bool sleeping = false;                          // Machine in sleep state, the display is off
+static uint32_t idle_since = 0;                        // Ticks of the last activity
+static int32_t idle_position[N_AXIS];                  // Position at the last activity
+static display_power_t power_set = DISPLAY_POWER_ON;   // Power state set from the activity
+
+#if DISPLAY_SETTINGS
+static nvs_address_t nvs_address;
+static display_settings_t display_settings;
+#endif //DISPLAY_SETTINGS
+
+#if DISPLAY_MIRROR
+static stream_write_ptr mirror_write = NULL; // Write function of the stream subscribed to mirroring
+#endif //DISPLAY_MIRROR
+#if DISPLAY_SCREENSHOT
+static screenshot_t screenshot = {0};
+#endif //DISPLAY_SCREENSHOT
+#if DISPLAY_MENU
+static menu_t menu = {0};
+static const char *const menu_labels[MENU_ENTRIES] = { "WCS", "UNITS", "CONTRAST", "FLIP", "EXIT" };
+static const uint8_t menu_contrasts[] = { 0x10, 0x40, 0x80, 0xCF, 0xFF };
+#endif //DISPLAY_MENU
+
 // --------------------------------------------------------
 // Function Prototypes
 // --------------------------------------------------------
@@ -81,6 +319,118 @@ static on_network_event_ptr on_event;
 static void report_options(bool newopt);
 static void onStateChanged(sys_state_t state);
 static void polling_task(void *data);
+static void display_start(void *data);
+static void update_screen(void);
+static bool update_power(bool activity);
+static void power_task(void *data);
+static bool prepare_layout(void);
+static bool layout_batched(uint8_t i);
+static void draw_layout(void);
+static void draw_status_icon(int16_t *x, int16_t x_max, bool active, uint8_t id);
+#if DISPLAY_THROTTLE_STEP_RATE
+static uint8_t get_throttle_level(uint8_t level);
+#endif //DISPLAY_THROTTLE_STEP_RATE
+#if DISPLAY_MIRROR || DISPLAY_SCREENSHOT
+static char *base64_encode(char *out, const uint8_t *data, uint16_t length);
+#endif //DISPLAY_MIRROR || DISPLAY_SCREENSHOT
+#if DISPLAY_MIRROR
+static status_code_t mirror_command(sys_state_t state, char *args);
+static void mirror_span(uint8_t page, uint8_t column, uint8_t length, const uint8_t *data);
+#endif //DISPLAY_MIRROR
+#if DISPLAY_SCREENSHOT
+static status_code_t screenshot_command(sys_state_t state, char *args);
+static void screenshot_task(void *data);
+#endif //DISPLAY_SCREENSHOT
+#if DISPLAY_MENU
+static bool menu_init(void);
+static void menu_input_irq(uint8_t port, bool state);
+static void menu_task(void *data);
+static void menu_draw(void);
+static uint8_t menu_row_height(void);
+static void menu_highlight(uint8_t entry);
+static void menu_select(void);
+#endif //DISPLAY_MENU
+
+#if DISPLAY_SETTINGS
+static status_code_t display_setting_set(setting_id_t id, uint_fast16_t value);
+static uint32_t display_setting_get(setting_id_t id);
+static void display_settings_apply(void);
+static void display_settings_save(void);
+static void display_settings_restore(void);
+static void display_settings_load(void);
+
+// Panels selected by the driver setting: name and first column in the controller memory.
+// The SH1106 only drives 128 x 64 panels.
+static const struct {
+    const char *name;
+    uint8_t column_offset;
+} display_drivers[] = {
+#if DISPLAY_PANEL == DISPLAY_PANEL_72X40
+    { "SSD1306 I2C", 28 }   // 72 columns centered in the 128 columns memory
+#elif DISPLAY_PANEL == DISPLAY_PANEL_128X32
+    { "SSD1306 I2C", 0 }
+#else
+    { "SH1106 I2C", 2 },
+    { "SSD1306 I2C", 0 }
+#endif //DISPLAY_PANEL
+};
+
+#if DISPLAY_PANEL == DISPLAY_PANEL_128X64
+#define DISPLAY_DRIVERS_FORMAT "SH1106,SSD1306"
+#else
+#define DISPLAY_DRIVERS_FORMAT "SSD1306"
+#endif //DISPLAY_PANEL == DISPLAY_PANEL_128X64
+
+static const setting_detail_t display_settings_list[] = {
+    { Setting_DisplayRefreshInterval, Group_UserSettings, "Display refresh interval", "ms", Format_Int16, "####0", "50", "10000", Setting_NonCoreFn, display_setting_set, display_setting_get, NULL },
+    { Setting_DisplayI2CAddress, Group_UserSettings, "Display I2C address", NULL, Format_Int8, "##0", "8", "119", Setting_NonCoreFn, display_setting_set, display_setting_get, NULL },
+    { Setting_DisplayDriver, Group_UserSettings, "Display driver", NULL, Format_RadioButtons, DISPLAY_DRIVERS_FORMAT, NULL, NULL, Setting_NonCoreFn, display_setting_set, display_setting_get, NULL },
+    { Setting_DisplayFlipped, Group_UserSettings, "Display flipped", NULL, Format_Bool, NULL, NULL, NULL, Setting_NonCoreFn, display_setting_set, display_setting_get, NULL },
+    { Setting_DisplayContrast, Group_UserSettings, "Display contrast", NULL, Format_Int8, "##0", "0", "255", Setting_NonCoreFn, display_setting_set, display_setting_get, NULL },
+    { Setting_DisplayRefreshBudget, Group_UserSettings, "Display refresh budget", "bytes", Format_Int16, "###0", "0", "1024", Setting_NonCoreFn, display_setting_set, display_setting_get, NULL },
+    { Setting_DisplayLayout, Group_UserSettings, "Display layout", NULL, Format_Bitfield, "IP address,Status icons,Endstops", NULL, NULL, Setting_NonCoreFn, display_setting_set, display_setting_get, NULL }
+};
+
+#ifndef NO_SETTINGS_DESCRIPTIONS
+static const setting_descr_t display_settings_descr[] = {
+    { Setting_DisplayRefreshInterval, "Delay between two display updates in milliseconds." },
+    { Setting_DisplayI2CAddress, "I2C address of the display, 60 (0x3C) for most displays." },
+    { Setting_DisplayDriver, "Display controller, the SH1106 shows columns 2 to 129 of its memory." },
+    { Setting_DisplayFlipped, "Rotate the display by 180 degrees." },
+    { Setting_DisplayContrast, "Display contrast, lower values save the panel." },
+    { Setting_DisplayRefreshBudget, "Bytes sent by a refresh before the other devices of the I2C bus can be used, the rest is sent from the next foreground loop. 0 for no limit." },
+    { Setting_DisplayLayout, "Optional fields shown by the layout, the others are left blank." }
+};
+#endif //NO_SETTINGS_DESCRIPTIONS
+
+static setting_details_t setting_details = {
+    .settings = display_settings_list,
+    .n_settings = sizeof(display_settings_list) / sizeof(setting_detail_t),
+#ifndef NO_SETTINGS_DESCRIPTIONS
+    .descriptions = display_settings_descr,
+    .n_descriptions = sizeof(display_settings_descr) / sizeof(setting_descr_t),
+#endif //NO_SETTINGS_DESCRIPTIONS
+    .save = display_settings_save,
+    .load = display_settings_load,
+    .restore = display_settings_restore
+};
+#endif //DISPLAY_SETTINGS
+
+#if DISPLAY_MIRROR || DISPLAY_SCREENSHOT
+static const sys_command_t display_command_list[] = {
+#if DISPLAY_MIRROR
+    {"OLEDMIRROR", mirror_command, { .allow_blocking = On }, { .str = "mirror the display changes to this stream, =0 to stop" } },
+#endif //DISPLAY_MIRROR
+#if DISPLAY_SCREENSHOT
+    {"OLEDSHOT", screenshot_command, { .allow_blocking = On }, { .str = "write the display content as a compressed PBM image, =BACK for the buffer being drawn" } },
+#endif //DISPLAY_SCREENSHOT
+};
+
+static sys_commands_t display_commands = {
+    .n_commands = sizeof(display_command_list) / sizeof(sys_command_t),
+    .commands = display_command_list
+};
+#endif //DISPLAY_MIRROR || DISPLAY_SCREENSHOT
 
 
 // Public initialization function
@@ -120,7 +470,7 @@ static void report_options(bool newopt)
         hal.stream.write(",DISPLAY");
     } else {
         char buffer[50];
-        snprintf(buffer, sizeof(buffer), "%s - (%s %sconnected)", PLUGGIN_DISPLAY_VERSION, display_name(), display_connected() ? "" : "not ");
+        snprintf(buffer, sizeof(buffer), "%s - (%s %s)", PLUGGIN_DISPLAY_VERSION, display_name(), display_connected() ? "connected" : display_virtual() ? "virtual" : "not connected");
         report_plugin("Display",buffer);
     }
 }
@@ -130,6 +480,10 @@ static void onStateChanged(sys_state_t state)
     if(on_state_change){
         on_state_change(state);
     }
+    screen1.locked = (state == STATE_ALARM || state == STATE_ESTOP);
+    // A state change wakes the display, unless it is the sleep state
+    sleeping = (state == STATE_SLEEP);
+    task_add_immediate(power_task, NULL);
     switch(state) {
         case STATE_IDLE:
             screen1.state = "IDLE";
@@ -165,18 +519,746 @@ static void onStateChanged(sys_state_t state)
     };
 }
 
+#if DISPLAY_SETTINGS
+// --------------------------------------------------------
+// Settings
+// --------------------------------------------------------
+
+/**
+ * Change a setting, the display is updated at once
+ */
+static status_code_t display_setting_set(setting_id_t id, uint_fast16_t value)
+{
+    switch (id) {
+        case Setting_DisplayRefreshInterval:
+            display_settings.refresh_interval = value;
+            polling_delay = value;
+            break;
+        case Setting_DisplayI2CAddress:
+            display_settings.i2c_address = value;
+            display_set_panel(value, display_config.column_offset);
+            break;
+        case Setting_DisplayDriver:
+            if (value >= sizeof(display_drivers) / sizeof(display_drivers[0])) {
+                return Status_SettingValueOutOfRange;
+            }
+            display_settings.driver = value;
+            display_config.name = display_drivers[value].name;
+            display_set_panel(display_config.i2c_address, display_drivers[value].column_offset);
+            break;
+        case Setting_DisplayFlipped:
+            display_settings.flipped = value != 0;
+            display_set_flipped(display_settings.flipped);
+            break;
+        case Setting_DisplayContrast:
+            display_settings.contrast = value;
+            display_set_contrast(value);
+            break;
+        case Setting_DisplayRefreshBudget:
+            display_settings.refresh_budget = value;
+            display_set_refresh_budget(value);
+            break;
+        case Setting_DisplayLayout:
+            display_settings.layout = value & LAYOUT_SHOW_ALL;
+            break;
+        default:
+            return Status_InvalidStatement;
+    }
+
+    return Status_OK;
+}
+
+static uint32_t display_setting_get(setting_id_t id)
+{
+    switch (id) {
+        case Setting_DisplayRefreshInterval:
+            return display_settings.refresh_interval;
+        case Setting_DisplayI2CAddress:
+            return display_settings.i2c_address;
+        case Setting_DisplayDriver:
+            return display_settings.driver;
+        case Setting_DisplayFlipped:
+            return display_settings.flipped;
+        case Setting_DisplayContrast:
+            return display_settings.contrast;
+        case Setting_DisplayRefreshBudget:
+            return display_settings.refresh_budget;
+        case Setting_DisplayLayout:
+            return display_settings.layout;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Apply the settings needed before the display is started
+ */
+static void display_settings_apply(void)
+{
+    polling_delay = display_settings.refresh_interval;
+    display_config.i2c_address = display_settings.i2c_address;
+    display_config.name = display_drivers[display_settings.driver].name;
+    display_config.column_offset = display_drivers[display_settings.driver].column_offset;
+    display_set_refresh_budget(display_settings.refresh_budget);
+}
+
+static void display_settings_save(void)
+{
+    hal.nvs.memcpy_to_nvs(nvs_address, (uint8_t *)&display_settings, sizeof(display_settings_t), true);
+}
+
+static void display_settings_restore(void)
+{
+    display_settings.refresh_interval = POLLING_DELAY;
+    display_settings.i2c_address = DISPLAY_I2C_ADDRESS;
+#if DISPLAY_PANEL == DISPLAY_PANEL_128X64 && defined(DISPLAY_DRIVER) && defined(DISPLAY_DRIVER_SSD1306) && DISPLAY_DRIVER == DISPLAY_DRIVER_SSD1306
+    display_settings.driver = 1;
+#else
+    display_settings.driver = 0;
+#endif
+    display_settings.flipped = false;
+    display_settings.contrast = DISPLAY_CONTRAST;
+    display_settings.refresh_budget = DISPLAY_REFRESH_BUDGET;
+    display_settings.layout = LAYOUT_SHOW_ALL;
+
+    if (nvs_address) {
+        display_settings_save();
+    }
+}
+
+static void display_settings_load(void)
+{
+    if (hal.nvs.memcpy_from_nvs((uint8_t *)&display_settings, nvs_address, sizeof(display_settings_t), true) != NVS_TransferResult_OK ||
+         display_settings.driver >= sizeof(display_drivers) / sizeof(display_drivers[0])) {
+        display_settings_restore();
+    }
+}
+#endif //DISPLAY_SETTINGS
+
+
+#if DISPLAY_MIRROR || DISPLAY_SCREENSHOT
+// --------------------------------------------------------
+// Display Mirroring and Screenshots
+// --------------------------------------------------------
+
+/**
+ * Encode bytes in base64, returns the end of the encoded text (not terminated)
+ */
+static char *base64_encode(char *out, const uint8_t *data, uint16_t length)
+{
+    static const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    for (uint16_t i = 0; i < length; i += 3) {
+        uint32_t bits = ((uint32_t)data[i] << 16) | ((i + 1 < length ? data[i + 1] : 0) << 8) | (i + 2 < length ? data[i + 2] : 0);
+        *out++ = base64[(bits >> 18) & 0x3F];
+        *out++ = base64[(bits >> 12) & 0x3F];
+        *out++ = i + 1 < length ? base64[(bits >> 6) & 0x3F] : '=';
+        *out++ = i + 2 < length ? base64[bits & 0x3F] : '=';
+    }
+    return out;
+}
+#endif //DISPLAY_MIRROR || DISPLAY_SCREENSHOT
+
+#if DISPLAY_MIRROR
+
+/**
+ * $OLEDMIRROR subscribes the current stream to display mirroring, starting with a key frame
+ * $OLEDMIRROR=0 stops mirroring
+ * Records (see tools/mirror_decoder.py):
+ *   [OLED:KEY,width,height]              key frame start, the whole display follows
+ *   [OLED:page,column,length,base64]     span of a page, in the display memory layout
+ *   [OLED:END]                           end of refresh
+ */
+static status_code_t mirror_command(sys_state_t state, char *args)
+{
+    (void)state;
+
+    if (args && !strcmp(args, "0")) {
+        display_set_refresh_listener(NULL);
+        mirror_write = NULL;
+        return Status_OK;
+    }
+    if (args && strcmp(args, "1")) {
+        return Status_InvalidStatement;
+    }
+
+    char record[32];
+    // Frames are not drawn when nothing uses them, draw the current one
+    if (!display_has_consumer()) {
+        update_screen();
+    }
+    mirror_write = hal.stream.write;
+    snprintf(record, sizeof(record), "[OLED:KEY,%u,%u]" ASCII_EOL, display_config.width, display_config.height);
+    mirror_write(record);
+    display_set_refresh_listener(mirror_span);
+    display_replay_frame();
+
+    return Status_OK;
+}
+
+/**
+ * Write a span sent to the display as a base64 record
+ */
+static void mirror_span(uint8_t page, uint8_t column, uint8_t length, const uint8_t *data)
+{
+    char record[20 + (((255 + 2) / 3) * 4) + 4];
+
+    if (mirror_write == NULL) {
+        return;
+    }
+    if (length == 0) {
+        mirror_write("[OLED:END]" ASCII_EOL);
+        return;
+    }
+
+    char *out = record + snprintf(record, 20, "[OLED:%u,%u,%u,", page, column, length);
+    out = base64_encode(out, data, length);
+    strcpy(out, "]" ASCII_EOL);
+    mirror_write(record);
+}
+#endif //DISPLAY_MIRROR
+
+#if DISPLAY_SCREENSHOT
+/**
+ * $OLEDSHOT writes the display content (front buffer) as a P4 PBM image, $OLEDSHOT=BACK
+ * writes the buffer being drawn
+ * The image is run length encoded like image files and written in records of
+ * DISPLAY_SCREENSHOT_CHUNK bytes from a task, so other stream traffic is not delayed
+ * Records (see tools/mirror_decoder.py):
+ *   [OLEDSHOT:BEGIN,width,height,PBM size]
+ *   [OLEDSHOT:base64]                    run length encoded PBM bytes
+ *   [OLEDSHOT:END,compressed size]
+ */
+static status_code_t screenshot_command(sys_state_t state, char *args)
+{
+    (void)state;
+    const uint8_t *buffer = display_config.front_buffer;
+    char record[48];
+
+    if (args && !strcmp(args, "BACK")) {
+        buffer = display_config.back_buffer;
+    } else if (args && strcmp(args, "FRONT")) {
+        return Status_InvalidStatement;
+    }
+
+    // Frames are not drawn when nothing uses them, draw the current one
+    if (!display_has_consumer()) {
+        update_screen();
+    }
+
+    // Take a copy so the image is not torn by the next refresh, a new request restarts
+    if (screenshot.snapshot == NULL) {
+        screenshot.snapshot = (uint8_t *)malloc(display_config.buffer_size);
+        if (screenshot.snapshot == NULL) {
+            return Status_InvalidStatement;
+        }
+        task_add_immediate(screenshot_task, NULL);
+    }
+    memcpy(screenshot.snapshot, buffer, display_config.buffer_size);
+
+    screenshot.header_size = snprintf(screenshot.header, sizeof(screenshot.header), "P4\n%u %u\n", display_config.width, display_config.height);
+    screenshot.size = screenshot.header_size + (((display_config.width + 7) / 8) * display_config.height);
+    screenshot.position = 0;
+    screenshot.written = 0;
+    screenshot.write = hal.stream.write;
+
+    snprintf(record, sizeof(record), "[OLEDSHOT:BEGIN,%u,%u,%u]" ASCII_EOL, display_config.width, display_config.height, screenshot.size);
+    screenshot.write(record);
+
+    return Status_OK;
+}
+
+/**
+ * Get a byte of the PBM file of the screenshot
+ */
+static uint8_t screenshot_byte(uint16_t index)
+{
+    if (index < screenshot.header_size) {
+        return screenshot.header[index];
+    }
+
+    // Rows of pixels, most significant bit first
+    uint8_t row_bytes = (display_config.width + 7) / 8;
+    uint16_t y = (index - screenshot.header_size) / row_bytes;
+    uint16_t x = ((index - screenshot.header_size) % row_bytes) * 8;
+    uint8_t byte = 0;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        // PBM 1 is black: unlit pixels and row padding are set
+        if (x + bit >= display_config.width || !((screenshot.snapshot[((y / 8) * display_config.width) + x + bit] >> (y % 8)) & 0x01)) {
+            byte |= 0x80 >> bit;
+        }
+    }
+    return byte;
+}
+
+/**
+ * Write the next screenshot record
+ */
+static void screenshot_task(void *data)
+{
+    uint8_t chunk[DISPLAY_SCREENSHOT_CHUNK];
+    uint8_t length = 0;
+    char record[12 + (((DISPLAY_SCREENSHOT_CHUNK + 2) / 3) * 4) + 4];
+    (void)data;
+
+    if (screenshot.snapshot == NULL) {
+        return;
+    }
+
+    // Runs of 3 or more identical bytes are [0x80 | (count - 1)][byte], other bytes [count - 1][bytes]
+    while (screenshot.position < screenshot.size && length + 2 <= DISPLAY_SCREENSHOT_CHUNK) {
+        uint8_t byte = screenshot_byte(screenshot.position);
+        uint8_t run = 1;
+        while (screenshot.position + run < screenshot.size && run < 128 && screenshot_byte(screenshot.position + run) == byte) {
+            run++;
+        }
+        if (run >= 3) {
+            chunk[length++] = 0x80 | (run - 1);
+            chunk[length++] = byte;
+            screenshot.position += run;
+            continue;
+        }
+
+        // Literal until the next run of 3 identical bytes or the end of the chunk
+        uint8_t *count = &chunk[length++];
+        uint8_t literal = 0;
+        while (screenshot.position < screenshot.size && literal < 128 && length < DISPLAY_SCREENSHOT_CHUNK) {
+            uint16_t i = screenshot.position;
+            if (literal > 0 && i + 2 < screenshot.size && screenshot_byte(i) == screenshot_byte(i + 1) && screenshot_byte(i) == screenshot_byte(i + 2)) {
+                break;
+            }
+            chunk[length++] = screenshot_byte(i);
+            screenshot.position++;
+            literal++;
+        }
+        *count = literal - 1;
+    }
+
+    char *out = base64_encode(record + sprintf(record, "[OLEDSHOT:"), chunk, length);
+    strcpy(out, "]" ASCII_EOL);
+    screenshot.write(record);
+    screenshot.written += length;
+
+    if (screenshot.position < screenshot.size) {
+        task_add_immediate(screenshot_task, NULL);
+        return;
+    }
+
+    snprintf(record, sizeof(record), "[OLEDSHOT:END,%u]" ASCII_EOL, screenshot.written);
+    screenshot.write(record);
+    free(screenshot.snapshot);
+    screenshot.snapshot = NULL;
+}
+#endif //DISPLAY_SCREENSHOT
+
+#if DISPLAY_MENU
+// --------------------------------------------------------
+// Menu
+// --------------------------------------------------------
+
+/**
+ * Claim the menu inputs and enable their interrupts
+ * Ports are claimed from the highest number, so claiming a port does not change the
+ * number of the ports left to claim
+ */
+static bool menu_init(void)
+{
+    static const char *const descriptions[MENU_INPUTS] = { "Display menu up", "Display menu down", "Display menu select" };
+    bool claimed[MENU_INPUTS] = { false };
+    bool success = true;
+
+    menu.ports[MENU_INPUT_UP] = DISPLAY_MENU_PORT_UP;
+    menu.ports[MENU_INPUT_DOWN] = DISPLAY_MENU_PORT_DOWN;
+    menu.ports[MENU_INPUT_SELECT] = DISPLAY_MENU_PORT_SELECT;
+
+    for (uint8_t n = 0; n < MENU_INPUTS; n++) {
+        uint8_t input = MENU_INPUTS;
+        for (uint8_t i = 0; i < MENU_INPUTS; i++) {
+            if (!claimed[i] && (input == MENU_INPUTS || menu.ports[i] > menu.ports[input])) {
+                input = i;
+            }
+        }
+        if (!ioport_claim(Port_Digital, Port_Input, &menu.ports[input], descriptions[input])) {
+            return false;
+        }
+        claimed[input] = true;
+    }
+
+    for (uint8_t i = 0; i < MENU_INPUTS; i++) {
+#if DISPLAY_MENU_ENCODER
+        // Phase B is read on the edges of phase A
+        if (i == MENU_INPUT_DOWN) {
+            continue;
+        }
+#endif //DISPLAY_MENU_ENCODER
+        success &= ioport_enable_irq(menu.ports[i], IRQ_Mode_Falling, menu_input_irq);
+    }
+
+    return success;
+}
+
+/**
+ * Record an edge of a menu input, called from the interrupt
+ * The display is drawn by menu_task from the next foreground loop
+ */
+static void menu_input_irq(uint8_t port, bool state)
+{
+    uint32_t now = hal.get_elapsed_ticks();
+
+    for (uint8_t i = 0; i < MENU_INPUTS; i++) {
+        if (menu.ports[i] != port || now - menu.edge_ticks[i] < DISPLAY_MENU_DEBOUNCE) {
+            continue;
+        }
+        menu.edge_ticks[i] = now;
+
+        switch (i) {
+            case MENU_INPUT_UP:
+#if DISPLAY_MENU_ENCODER
+                // Falling edge of phase A, phase B gives the direction
+                menu.steps += hal.port.wait_on_input(Port_Digital, menu.ports[MENU_INPUT_DOWN], WaitMode_Immediate, 0.0f) == 1 ? 1 : -1;
+#else
+                menu.steps--;
+#endif //DISPLAY_MENU_ENCODER
+                break;
+            case MENU_INPUT_DOWN:
+                menu.steps++;
+                break;
+            default:
+                menu.select = true;
+                break;
+        }
+
+        if (!menu.pending) {
+            menu.pending = task_add_immediate(menu_task, NULL);
+        }
+    }
+}
+
+/**
+ * Handle the menu inputs, the display is refreshed at once
+ * Select opens the menu, then changes the highlighted entry. Moving the highlight
+ * only inverts the old and new rows, so at most 4 pages are sent (a row can straddle 2 pages)
+ */
+static void menu_task(void *data)
+{
+    bool was_off = display_get_power() == DISPLAY_POWER_OFF;
+
+    // Taken with the interrupts off, an edge between the read and the clear would be lost
+    hal.irq_disable();
+    int8_t steps = menu.steps;
+    bool select = menu.select;
+    menu.steps = 0;
+    menu.select = false;
+    menu.pending = false;
+    hal.irq_enable();
+    menu.ticks = hal.get_elapsed_ticks();
+
+    // An input while the display is off only wakes it
+    if (update_power(true)) {
+        return;
+    }
+    if (was_off) {
+        update_screen();
+        return;
+    }
+
+    if (!menu.open) {
+        if (select) {
+            menu.open = true;
+            menu.selected = 0;
+            menu.top = 0;
+            update_screen();
+        }
+        return;
+    }
+
+    if (steps != 0) {
+        uint8_t selected = (menu.selected + MENU_ENTRIES + (steps % MENU_ENTRIES)) % MENU_ENTRIES;
+        uint8_t rows = display_config.height / menu_row_height();
+        if (selected >= menu.top && selected < menu.top + rows) {
+            menu_highlight(menu.selected);
+            menu_highlight(selected);
+            menu.selected = selected;
+        } else {
+            // Scroll to show the entry
+            menu.top = selected < menu.top ? selected : selected - rows + 1;
+            menu.selected = selected;
+            menu_draw();
+        }
+    }
+
+    if (select) {
+        menu_select();
+        update_screen();
+    } else {
+        display_refresh();
+    }
+}
+
+/**
+ * Text of the value of a menu entry
+ */
+static const char *menu_value(uint8_t entry, char *buffer, size_t size)
+{
+    switch (entry) {
+        case MENU_WCS:
+            if (gc_state.modal.coord_system.id < CoordinateSystem_G59_1) {
+                snprintf(buffer, size, "G%u", 54 + gc_state.modal.coord_system.id);
+            } else {
+                snprintf(buffer, size, "G59.%u", gc_state.modal.coord_system.id - CoordinateSystem_G59);
+            }
+            return buffer;
+        case MENU_UNITS:
+            return settings.flags.report_inches ? "INCH" : "MM";
+        case MENU_CONTRAST:
+            snprintf(buffer, size, "%u%%", ((menu.contrast * 100) + 127) / 255);
+            return buffer;
+        case MENU_FLIP:
+            return menu.flipped ? "ON" : "OFF";
+        default:
+            return "";
+    }
+}
+
+/**
+ * Draw the menu, an entry on each row of the small font height, rows straddle pages
+ * Texts are drawn without background, which would erase the bottom of the row above
+ */
+static void menu_draw(void)
+{
+    const char *font = display_config.display_small_font;
+    uint8_t row_height = menu_row_height();
+    char value[8];
+
+    display_clear();
+    display_set_color(DISPLAY_COLOR_WHITE);
+    for (uint8_t row = 0; row < display_config.height / row_height && menu.top + row < MENU_ENTRIES; row++) {
+        uint8_t entry = menu.top + row;
+        const char *text = menu_value(entry, value, sizeof(value));
+        int16_t y = row * row_height;
+
+        display_draw_string_with_font(2, y, menu_labels[entry], font);
+        display_draw_string_with_font(display_config.width - 2 - get_string_width_with_font(text, strlen(text), font), y, text, font);
+    }
+    menu_highlight(menu.selected);
+}
+
+/**
+ * Invert the row of a menu entry
+ */
+static void menu_highlight(uint8_t entry)
+{
+    uint8_t row_height = menu_row_height();
+
+    display_invert_rect(0, (entry - menu.top) * row_height, display_config.width, row_height);
+}
+
+/**
+ * Pitch of the menu rows, the height of the small font
+ */
+static uint8_t menu_row_height(void)
+{
+    return get_font_height_with_font(display_config.display_small_font);
+}
+
+/**
+ * Change the value of the highlighted entry, or close the menu
+ */
+static void menu_select(void)
+{
+    switch (menu.selected) {
+        case MENU_WCS:
+            // The new value is shown once the command is executed
+            if (state_get() == STATE_IDLE && grbl.enqueue_gcode) {
+                char gcode[4];
+                snprintf(gcode, sizeof(gcode), "G%u", 54 + ((gc_state.modal.coord_system.id + 1) % CoordinateSystem_G59_1));
+                grbl.enqueue_gcode(gcode);
+            }
+            break;
+        case MENU_UNITS:
+            settings_store_setting(Setting_ReportInches, settings.flags.report_inches ? "0" : "1");
+            break;
+        case MENU_CONTRAST: {
+            uint8_t level = 0;
+            while (level < sizeof(menu_contrasts) && menu_contrasts[level] <= menu.contrast) {
+                level++;
+            }
+            menu.contrast = menu_contrasts[level % sizeof(menu_contrasts)];
+#if DISPLAY_SETTINGS
+            display_setting_set(Setting_DisplayContrast, menu.contrast);
+            if (nvs_address) {
+                display_settings_save();
+            }
+#else
+            display_set_contrast(menu.contrast);
+#endif //DISPLAY_SETTINGS
+            break;
+        }
+        case MENU_FLIP:
+            menu.flipped = !menu.flipped;
+#if DISPLAY_SETTINGS
+            display_setting_set(Setting_DisplayFlipped, menu.flipped);
+            if (nvs_address) {
+                display_settings_save();
+            }
+#else
+            display_set_flipped(menu.flipped);
+#endif //DISPLAY_SETTINGS
+            break;
+        default:
+            menu.open = false;
+            break;
+    }
+}
+#endif //DISPLAY_MENU
+
+/**
+ * Draw a status icon of the top row if active and if there is room left
+ */
+static void draw_status_icon(int16_t *x, int16_t x_max, bool active, uint8_t id) {
+    uint8_t width = display_get_icon_width(icons, id);
+
+    if (active && *x + width <= x_max) {
+        display_draw_icon(*x, 0, icons, id);
+        *x += width + 2;
+    }
+}
+
+#if DISPLAY_THROTTLE_STEP_RATE
+/**
+ * Get the throttle level for the current step rate
+ * The level is raised at each doubling of DISPLAY_THROTTLE_STEP_RATE, and only lowered
+ * well below, so the frame rate does not toggle around a threshold
+ */
+static uint8_t get_throttle_level(uint8_t level) {
+    float steps_per_mm = 0.0f;
+
+    for (uint_fast8_t idx = 0; idx < N_AXIS; idx++) {
+        if (settings.axis[idx].steps_per_mm > steps_per_mm) {
+            steps_per_mm = settings.axis[idx].steps_per_mm;
+        }
+    }
+    // Realtime rate is in mm/min
+    float step_rate = st_get_realtime_rate() * steps_per_mm / 60.0f;
+
+    while (level < DISPLAY_THROTTLE_LEVELS && step_rate >= (float)DISPLAY_THROTTLE_STEP_RATE * (1 << level)) {
+        level++;
+    }
+    while (level > 0 && step_rate < (float)DISPLAY_THROTTLE_STEP_RATE * (1 << (level - 1)) * 0.75f) {
+        level--;
+    }
+
+    return level;
+}
+#endif //DISPLAY_THROTTLE_STEP_RATE
+
+/**
+ * Update the display power state from the machine activity
+ * Moves, state changes (alarms included) and a wake by another plugin
+ * with display_set_power() are activity
+ * Returns true if the display is off, then nothing is drawn nor sent
+ */
+static bool update_power(bool activity) {
+    uint32_t now = hal.get_elapsed_ticks();
+    display_power_t power = DISPLAY_POWER_ON;
+
+    if (memcmp(idle_position, sys.position, sizeof(idle_position)) || display_get_power() != power_set) {
+        memcpy(idle_position, sys.position, sizeof(idle_position));
+        activity = true;
+    }
+    if (activity) {
+        idle_since = now;
+    }
+
+    if (sleeping) {
+        power = DISPLAY_POWER_OFF;
+    }
+#if DISPLAY_OFF_TIMEOUT
+    else if (now - idle_since >= DISPLAY_OFF_TIMEOUT * 1000UL) {
+        power = DISPLAY_POWER_OFF;
+    }
+#endif //DISPLAY_OFF_TIMEOUT
+#if DISPLAY_DIM_TIMEOUT
+    else if (now - idle_since >= DISPLAY_DIM_TIMEOUT * 1000UL) {
+        power = DISPLAY_POWER_DIM;
+    }
+#endif //DISPLAY_DIM_TIMEOUT
+
+    display_set_power(power);
+    power_set = power;
+
+    return power == DISPLAY_POWER_OFF;
+}
+
+/**
+ * Apply a state change to the display power, the screen is drawn at once on wake
+ */
+static void power_task(void *data) {
+    bool was_off = display_get_power() == DISPLAY_POWER_OFF;
+
+    if (!update_power(true) && was_off && display_has_consumer()) {
+        update_screen();
+    }
+}
 
 /**
  * Polling task for updating display data
  */
 static void polling_task(void *data) {
+    // Let the boot animation finish
+    if (display_animation_playing()) {
+        task_add_delayed(polling_task, data, polling_delay);
+        return;
+    }
+
     if (data) {
         display_clear();
     }
     
     // Add next polling
-    task_add_delayed(polling_task, NULL, POLLING_DELAY);
+    task_add_delayed(polling_task, NULL, polling_delay);
+    
+    // Skip the frame if the display is off
+    if (update_power(false)) {
+        return;
+    }
+
+    // Skip the frame if nothing uses it (virtual display not mirrored)
+    if (!display_has_consumer()) {
+        return;
+    }
+
+#if DISPLAY_MENU
+    // Back to the machine data without input
+    if (menu.open && hal.get_elapsed_ticks() - menu.ticks >= DISPLAY_MENU_TIMEOUT * 1000UL) {
+        menu.open = false;
+    }
+#endif //DISPLAY_MENU
+
+#if DISPLAY_THROTTLE_STEP_RATE
+    // Skip frames during fast moves, the stepper interrupt load is at its highest
+    // and the positions change at each frame
+    display_set_throttle(get_throttle_level(display_get_stats()->throttle_level));
+    if (display_throttled_frame()) {
+        return;
+    }
+#endif //DISPLAY_THROTTLE_STEP_RATE
     
+    update_screen();
+}
+
+/**
+ * Get the machine data and draw the screen
+ */
+static void update_screen(void) {
+#if DISPLAY_MENU
+    if (menu.open) {
+        menu_draw();
+        display_refresh();
+        return;
+    }
+#endif //DISPLAY_MENU
+
     // Get endstop status
     if (settings.status_report.pin_state) {
         axes_signals_t lim_pin_state = limit_signals_merge(hal.limits.get_state());
@@ -194,6 +1276,11 @@ static void polling_task(void *data) {
         }
     }
     
+    // Get spindle and coolant status
+    spindle_ptrs_t *spindle = spindle_get(0);
+    screen1.spindle_on = spindle && spindle->get_state && spindle->get_state(spindle).on;
+    screen1.coolant_on = hal.coolant.get_state && hal.coolant.get_state().value != 0;
+
     // Get positions
     float pos[N_AXIS];
     system_convert_array_steps_to_mpos(pos, sys.position);
@@ -207,124 +1294,244 @@ static void polling_task(void *data) {
 
     // Draw information on display
     display_clear();
-    // Top never change
-    display_set_font(DISPLAY_FONT_BIG);
-    display_set_color(DISPLAY_COLOR_BLACK);  
-    // Machine state
-    display_draw_string(1, 1, screen1.state);
-    
+    draw_layout();
+
+    // Update the display
+    display_refresh();
+}
+
+/**
+ * Text of a layout field, NULL if the field is not a text
+ */
+static const char *layout_text(const layout_field_t *field) {
+    switch (field->type) {
+        case LAYOUT_STATE:
+            return screen1.state;
 #if ETHERNET_ENABLE || WIFI_ENABLE
-    // IP address
-    display_set_color(DISPLAY_COLOR_WHITE);
-    display_set_font(DISPLAY_FONT_SMALL);
-    display_draw_string(128- get_string_width(screen1.ip)-1,2,screen1.ip);
+        case LAYOUT_IP:
+            return screen1.ip;
 #endif //ETHERNET_ENABLE || WIFI_ENABLE
+        case LAYOUT_LABEL:
+            return screen1.label[field->axis];
+        case LAYOUT_POSITION:
+            return screen1.pos_str[field->axis];
+        default:
+            return NULL;
+    }
+}
 
-//TODO: Current positions are for a 128x64 display
-//      Need to add a way to handle different display size when added
+/**
+ * Check if a layout field is not drawn
+ */
+static bool layout_hidden(const layout_field_t *field) {
+#if !(ETHERNET_ENABLE || WIFI_ENABLE)
+    if (field->type == LAYOUT_IP) {
+        return true;
+    }
+#endif //!(ETHERNET_ENABLE || WIFI_ENABLE)
+#if DISPLAY_SETTINGS
+    if ((field->type == LAYOUT_IP && !(display_settings.layout & LAYOUT_SHOW_IP)) ||
+        (field->type == LAYOUT_ICONS && !(display_settings.layout & LAYOUT_SHOW_ICONS)) ||
+        (field->type == LAYOUT_ENDSTOP && !(display_settings.layout & LAYOUT_SHOW_ENDSTOPS))) {
+        return true;
+    }
+#endif //DISPLAY_SETTINGS
 
-display_set_color(DISPLAY_COLOR_WHITE);
-display_set_font(DISPLAY_FONT_SMALL);
-    // Positions
+    return (field->flags & LAYOUT_ENDSTOP_ONLY) && screen1.end_stop[field->axis] == -1;
+}
 
-#if N_AXIS >= 5
-    // 2 columns for positions
-    display_set_font(DISPLAY_FONT_SMALL);
-    // Positions
-    //X
-    display_draw_string(0, 16, screen1.label[0]);
-    display_draw_string(60- get_string_width(screen1.pos_str[0]), 16, screen1.pos_str[0]);
+/**
+ * Left edge of a layout field
+ */
+static int16_t layout_align(const layout_field_t *field, uint16_t width, int16_t after_end) {
+    switch (field->align) {
+        case LAYOUT_ALIGN_RIGHT:
+            return field->x - width;
+        case LAYOUT_ALIGN_AFTER:
+            return after_end + field->x;
+        default:
+            return field->x;
+    }
+}
 
-    //Y
-    display_draw_string(0, 16+12, screen1.label[1]);
-    display_draw_string(60- get_string_width(screen1.pos_str[1]), 16+12, screen1.pos_str[1]);
+/**
+ * Check if a layout field is a text drawn with the others by display_draw_strings
+ * Texts placed after a field of variable width are drawn once it is placed
+ */
+static bool layout_batched(uint8_t i) {
+    return layout_text(&layout_fields[i]) != NULL &&
+           (layout_x[i] != LAYOUT_X_DYNAMIC || layout_fields[i].align != LAYOUT_ALIGN_AFTER);
+}
 
-    //Z
-    display_draw_string(0, 16+24, screen1.label[2]);
-    display_draw_string(60- get_string_width(screen1.pos_str[2]), 16+24, screen1.pos_str[2]);
+/**
+ * Draw the fields of the layout
+ * Fields of fixed width use the positions computed by prepare_layout
+ * Fixed rectangles are drawn first as they are the background of texts, then the texts
+ * in a single batch, then the fields placed from the texts (icons, endstops)
+ */
+static void draw_layout(void) {
+    int16_t left[LAYOUT_FIELDS];
+    int16_t right[LAYOUT_FIELDS];
+    display_string_t strings[LAYOUT_FIELDS];
+    uint8_t string_fields[LAYOUT_FIELDS];
+    uint8_t count = 0;
 
-    //A or U
-    display_draw_string(66, 16, screen1.label[3]);
-    display_draw_string(127-get_string_width(screen1.pos_str[3]), 16, screen1.pos_str[3]);
+    for (uint8_t i = 0; i < LAYOUT_FIELDS; i++) {
+        const layout_field_t *field = &layout_fields[i];
 
-    //B or V
-    display_draw_string(66, 16+12, screen1.label[4]);
-    display_draw_string(127-get_string_width(screen1.pos_str[4]), 16+12, screen1.pos_str[4]);
+        if (layout_hidden(field)) {
+            continue;
+        }
+        if (field->type == LAYOUT_FILL && layout_x[i] != LAYOUT_X_DYNAMIC) {
+            display_set_color(field->color);
+            display_fill_rect(layout_x[i], field->y, field->width, field->height);
+        } else if (layout_batched(i)) {
+            display_string_t *string = &strings[count];
+            display_set_font(field->font);
+            string->x = layout_x[i] != LAYOUT_X_DYNAMIC ? layout_x[i] : field->x;
+            string->y = field->y + (field->line * get_font_height());
+            string->align = layout_x[i] == LAYOUT_X_DYNAMIC && field->align == LAYOUT_ALIGN_RIGHT ? DISPLAY_ALIGN_RIGHT : DISPLAY_ALIGN_LEFT;
+            string->font = field->font;
+            string->color = field->color;
+            string->text = layout_text(field);
+            string_fields[count++] = i;
+        }
+    }
 
+    display_draw_strings(strings, count);
+    for (uint8_t n = 0; n < count; n++) {
+        left[string_fields[n]] = strings[n].left;
+        right[string_fields[n]] = strings[n].left + strings[n].width;
+    }
 
- #if N_AXIS == 6   
-    //C or W
-    display_draw_string(66, 16+24, screen1.label[5]);
-    display_draw_string(127-get_string_width(screen1.pos_str[5]), 16+24, screen1.pos_str[5]);
-#endif //N_AXIS == 6
+    for (uint8_t i = 0; i < LAYOUT_FIELDS; i++) {
+        const layout_field_t *field = &layout_fields[i];
+        const char *text = layout_text(field);
 
-    // Endstops
-    //Draw bottom area
-    display_set_color(DISPLAY_COLOR_WHITE);
-    display_fill_rect(0, 64-11, 128, 11);
-    // Draw endstops in black
-    display_set_color(DISPLAY_COLOR_BLACK);
-    for (uint8_t i = 0; i < N_AXIS; i++) {
-       // is endstop reporting ?
-        if (screen1.end_stop[i]!=-1) {
-            display_draw_string(1 + (i * 20), 64-10, screen1.label[i]);
-            // Draw endstop status
-            if (screen1.end_stop[i] == 1) {
-               display_fill_rect((2 + (i * 20)  + get_string_width(screen1.label[i])), 64-10, 5, 8);
-               
-            } else {
-               display_draw_rect((2 + (i * 20)  + get_string_width(screen1.label[i])), 64-10, 5, 8);
+        if (layout_hidden(field)) {
+            left[i] = right[i] = display_config.width;
+            continue;
+        }
+        if (layout_batched(i)) {
+            continue;
+        }
+
+        display_set_font(field->font);
+        display_set_color(field->color);
+
+        uint16_t width;
+        if (layout_x[i] != LAYOUT_X_DYNAMIC) {
+            left[i] = layout_x[i];
+            width = layout_width[i];
+        } else {
+            width = text ? get_string_width(text) : field->width;
+            left[i] = layout_align(field, width, field->after != LAYOUT_NONE ? right[field->after] : 0);
+        }
+        right[i] = left[i] + width;
+
+        int16_t y = field->y + (field->line * get_font_height());
+        int16_t height = field->height + ((field->flags & LAYOUT_FONT_HEIGHT) ? get_font_height() : 0);
+
+        switch (field->type) {
+            case LAYOUT_ICONS: {
+                // Status icons are page aligned so they are copied
+                int16_t x = left[i];
+                int16_t x_max = display_config.width;
+                if (field->before != LAYOUT_NONE && !layout_hidden(&layout_fields[field->before])) {
+                    x_max = left[field->before] - field->width;
+                }
+                draw_status_icon(&x, x_max, screen1.spindle_on, ICONS_SPINDLE);
+                draw_status_icon(&x, x_max, screen1.coolant_on, ICONS_COOLANT);
+                draw_status_icon(&x, x_max, screen1.locked, ICONS_LOCK);
+                right[i] = x;
+                break;
             }
-        } 
-            
-    }
-#else //N_AXIS < 5
-uint8_t spacing = 3;
-uint16_t x_end_stop_status = 90; 
-uint16_t start_x_row = 15;
-// 1 row for each position and limit state
-#if N_AXIS == 4
-    display_set_font(DISPLAY_FONT_SMALL);
-#else
-    display_set_font(DISPLAY_FONT_SMALL);
-    x_end_stop_status = 110;
-    start_x_row = 15;
-#endif //N_AXIS == 4
+            case LAYOUT_FILL:
+                if (layout_x[i] == LAYOUT_X_DYNAMIC) {
+                    display_fill_rect(left[i], y, field->width, height);
+                }
+                break;
+            case LAYOUT_ENDSTOP:
+                if (screen1.end_stop[field->axis] == 1) {
+                    display_fill_rect(left[i], y, field->width, height);
+                } else {
+                    display_draw_rect(left[i], y, field->width, height);
+                }
+                break;
+            default:
+                display_draw_string(left[i], y, text);
+                break;
+        }
+    }
+}
+
 
-#if  N_AXIS == 3
-    spacing = 6;
-#endif //N_AXIS == 3
+/**
+ * Compute the positions of the layout fields of fixed width, and declare
+ * the text rows of the layout so their glyphs are kept ready to copy
+ * Must be called again when fonts are changed
+ * Returns false if some text rows could not be kept
+ */
+static bool prepare_layout(void) {
+    char labels[(N_AXIS * 2) + 1];
+    bool rows_kept = true;
 
-#if  N_AXIS == 2
-    spacing = 10;
-#endif //N_AXIS == 2
+    for (uint8_t i = 0; i < N_AXIS; i++) {
+        labels[i * 2] = screen1.label[i][0];
+        labels[(i * 2) + 1] = ':';
+    }
+    labels[N_AXIS * 2] = '\0';
 
-#if  N_AXIS == 1
-    spacing = 15;
-#endif
+    for (uint8_t i = 0; i < LAYOUT_FIELDS; i++) {
+        const layout_field_t *field = &layout_fields[i];
+        const char *chars = NULL;
+        uint8_t width = field->width;
+        bool fixed = field->align != LAYOUT_ALIGN_AFTER || layout_x[field->after] != LAYOUT_X_DYNAMIC;
 
-for (uint8_t i = 0; i < N_AXIS; i++) {
+        display_set_font(field->font);
 
-    display_draw_string(start_x_row , 14 + (i* get_font_height() ) + ((i+1)*spacing), screen1.label[i]);
-    display_draw_string(x_end_stop_status - 5 - get_string_width(screen1.pos_str[i]), 14 + (i* get_font_height() ) + ((i+1)*(spacing)), screen1.pos_str[i]);
+        switch (field->type) {
+            case LAYOUT_STATE:
+                chars = "IDLECHKOMJGRUNSPA";
+                fixed = false;
+                break;
+#if ETHERNET_ENABLE || WIFI_ENABLE
+            case LAYOUT_IP:
+                chars = "0123456789.";
+                fixed = false;
+                break;
+#endif //ETHERNET_ENABLE || WIFI_ENABLE
+            case LAYOUT_LABEL:
+                chars = labels;
+                width = get_string_width(screen1.label[field->axis]);
+                break;
+            case LAYOUT_POSITION:
+                chars = "0123456789.-";
+                fixed = false;
+                break;
+            case LAYOUT_FILL:
+            case LAYOUT_ENDSTOP:
+                break;
+            default:
+                fixed = false;
+                break;
+        }
 
-    if (screen1.end_stop[i]!=-1) {
-        // Draw endstop status
-        if (screen1.end_stop[i] == 1) {
-           display_fill_rect( x_end_stop_status, 14 + (i* get_font_height() ) + ((i+1)*spacing), 5, get_font_height()-1);
-           
-        } else {
-           display_draw_rect( x_end_stop_status, 14 + (i* get_font_height() ) + ((i+1)*spacing), 5, get_font_height()-1);
+        // Labels, rectangles and fields placed after them do not change of position
+        layout_x[i] = LAYOUT_X_DYNAMIC;
+        if (fixed) {
+            layout_width[i] = width;
+            layout_x[i] = layout_align(field, width,
+                                       field->align == LAYOUT_ALIGN_AFTER ? layout_x[field->after] + layout_width[field->after] : 0);
         }
-    } 
-   
-}
-#endif //N_AXIS_NB >= 5
 
-    // Update the display
-    display_refresh();
-}
+        if (chars && !display_prepare_text_row(field->font, field->y + (field->line * get_font_height()), chars)) {
+            rows_kept = false;
+        }
+    }
 
+    return rows_kept;
+}
 
 /**
  * Initialize the OLED display plugin
@@ -349,13 +1556,70 @@ void display_init(void) {
     // Hook report options
     on_report_options = grbl.on_report_options;
     grbl.on_report_options = report_options;
-    
+
+#if DISPLAY_SETTINGS
+    // The display is started once the settings are loaded
+    if ((nvs_address = nvs_alloc(sizeof(display_settings_t)))) {
+        settings_register(&setting_details);
+    } else {
+        display_settings_restore();
+    }
+    task_run_on_startup(display_start, NULL);
+#else
+    display_start(NULL);
+#endif //DISPLAY_SETTINGS
+}
+
+/**
+ * Start the display and the polling
+ */
+static void display_start(void *data)
+{
+#if DISPLAY_SETTINGS
+    display_settings_apply();
+#endif //DISPLAY_SETTINGS
+
     // Initialize hardware display
     if (display_oled_init()) {
+#if DISPLAY_SETTINGS
+        if (display_settings.contrast != DISPLAY_CONTRAST) {
+            display_set_contrast(display_settings.contrast);
+        }
+        if (display_settings.flipped) {
+            display_set_flipped(true);
+        }
+#endif //DISPLAY_SETTINGS
+
         // Hook state change
         on_state_change = grbl.on_state_change;
         grbl.on_state_change = onStateChanged;
 
+        // Load font files if any, compiled fonts are kept otherwise
+        display_load_font(DISPLAY_FONT_SMALL, DISPLAY_FONT_FILES_PATH "small.bin");
+        display_load_font(DISPLAY_FONT_MEDIUM, DISPLAY_FONT_FILES_PATH "medium.bin");
+        display_load_font(DISPLAY_FONT_BIG, DISPLAY_FONT_FILES_PATH "big.bin");
+
+        // Prepare the layout and the glyphs of its text rows
+        if (!prepare_layout() && DISPLAY_TEXT_ROWS) {
+            report_warning("Display text rows could not all be prepared!");
+        }
+
+#if DISPLAY_MENU
+#if DISPLAY_SETTINGS
+        menu.contrast = display_settings.contrast;
+        menu.flipped = display_settings.flipped;
+#else
+        menu.contrast = DISPLAY_CONTRAST;
+#endif //DISPLAY_SETTINGS
+        if (!menu_init()) {
+            report_warning("Display menu inputs are not available!");
+        }
+#endif //DISPLAY_MENU
+
+#if DISPLAY_MIRROR || DISPLAY_SCREENSHOT
+        system_register_commands(&display_commands);
+#endif //DISPLAY_MIRROR || DISPLAY_SCREENSHOT
+
 #if ETHERNET_ENABLE || WIFI_ENABLE
         // Hook IP event
         on_event = networking.event;
@@ -364,7 +1628,7 @@ void display_init(void) {
 
         // Start polling task
         uint8_t clearscreen = 1;
-        task_add_delayed(polling_task, &clearscreen, POLLING_DELAY);
+        task_add_delayed(polling_task, &clearscreen, polling_delay);
     }
 }
 
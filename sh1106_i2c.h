@@ -23,9 +23,20 @@
 #ifndef SH1106_I2C_H
 #define SH1106_I2C_H
 #include "oled_display.h"
+#if DISPLAY_PANEL != DISPLAY_PANEL_128X64
+#error "SH1106 panels are 128 x 64, select the SSD1306 driver for smaller panels"
+#endif //DISPLAY_PANEL != DISPLAY_PANEL_128X64
+#if DISPLAY_FONT_SUBSET
+// Only the characters the layouts can produce, see tools/dro_usage.json
+#include "./fonts/subset/oled_9.h"
+#include "./fonts/subset/oled_11.h"
+#else
 #include "./fonts/oled_9.h"
 #include "./fonts/oled_11.h"
+#endif //DISPLAY_FONT_SUBSET
+#if DISPLAY_LOGO_COMPILED
 #include "./images/logo-120x48.h"
+#endif //DISPLAY_LOGO_COMPILED
 
 // Define the initialization sequence array
 static const uint8_t sh1106_init_sequence[] = { 
@@ -57,6 +68,10 @@ static const uint8_t sh1106_init_sequence[] = {
     0xAF  // Display on
   };
 
+#define COLUMN_OFFSET 2
+#define SHIFT_COMMAND_1 (COLUMN_OFFSET & 0x0F)
+#define SHIFT_COMMAND_2 ((COLUMN_OFFSET >> 4) & 0x0F)
+
 // Set default display configuration
 display_config_t display_config = {
   .name = "SH1106 I2C",
@@ -69,20 +84,25 @@ display_config_t display_config = {
   .buffer_size = 0,
   .command_head = 0x80,
   .data_head = 0x40,
+  .column_offset = COLUMN_OFFSET,
   .init_sequence_length = sizeof(sh1106_init_sequence),
   .init_sequence = (uint8_t *)sh1106_init_sequence,
   // Default font pointers
   .display_small_font = oled_9,
   .display_medium_font = oled_9,
   .display_big_font = oled_11,
+#if DISPLAY_LOGO_COMPILED
   .logo_width = LOGO_WIDTH,
   .logo_height= LOGO_HEIGH, 
   .logo_rle = false,
   .logo_bits = logo_bits
+#else
+  .logo_width = 0,
+  .logo_height= 0, 
+  .logo_rle = false,
+  .logo_bits = NULL
+#endif //DISPLAY_LOGO_COMPILED
 };
 
-#define SHIFT_COMMAND_1 (2 & 0x0F)
-#define SHIFT_COMMAND_2 ((2 >> 4) & 0x0F)
-
 
 #endif //SH1106_I2C_H
@@ -23,9 +23,43 @@
 #ifndef SSD1306_I2C_H
 #define SSD1306_I2C_H
 #include "oled_display.h"
+#if DISPLAY_FONT_SUBSET
+// Only the characters the layouts can produce, see tools/dro_usage.json
+#include "./fonts/subset/oled_9.h"
+#include "./fonts/subset/oled_11.h"
+#else
 #include "./fonts/oled_9.h"
 #include "./fonts/oled_11.h"
+#endif //DISPLAY_FONT_SUBSET
+
+// Panel geometry: size, multiplex ratio, COM pins configuration and first column in the controller memory
+#if DISPLAY_PANEL == DISPLAY_PANEL_128X32
+#define PANEL_WIDTH 128
+#define PANEL_HEIGHT 32
+#define PANEL_MULTIPLEX 0x1F
+#define PANEL_COM_PINS 0x02
+#define COLUMN_OFFSET 0
+#elif DISPLAY_PANEL == DISPLAY_PANEL_72X40
+#define PANEL_WIDTH 72
+#define PANEL_HEIGHT 40
+#define PANEL_MULTIPLEX 0x27
+#define PANEL_COM_PINS 0x12
+#define COLUMN_OFFSET 28
+#else
+#define PANEL_WIDTH 128
+#define PANEL_HEIGHT 64
+#define PANEL_MULTIPLEX 0x3F
+#define PANEL_COM_PINS 0x12
+#define COLUMN_OFFSET 0
+#endif //DISPLAY_PANEL
+
+// The logo does not fit on smaller panels
+#if DISPLAY_LOGO_COMPILED && DISPLAY_PANEL == DISPLAY_PANEL_128X64
 #include "./images/logo-120x48.h"
+#define PANEL_LOGO 1
+#else
+#define PANEL_LOGO 0
+#endif //DISPLAY_LOGO_COMPILED && DISPLAY_PANEL == DISPLAY_PANEL_128X64
 
 // Define the initialization sequence array
 static const uint8_t ssd1306_init_sequence[] = { 
@@ -33,7 +67,7 @@ static const uint8_t ssd1306_init_sequence[] = {
     0xD5, // Set display clock divide ratio/oscillator frequency
     0x80, // Set divide ratio
     0xA8, // Set multiplex ratio
-    0x3F, // 1/64 duty
+    PANEL_MULTIPLEX, // 1/height duty
     0xD3, // Set display offset
     0x00, // No offset
     0x40, // Set start line
@@ -44,44 +78,56 @@ static const uint8_t ssd1306_init_sequence[] = {
     0xA1, // Segment remap
     0xC8, // Com scan direction
     0xDA, // Set comp pins hardware configuration
-    0x12, // Set comp pins hardware configuration
+    PANEL_COM_PINS, // Sequential for 32 rows, alternative otherwise
     0x81, // Set contrast
     0xCF, // Set contrast for 0xCF
     0xD9, // Set pre-charge period
     0xF1, // Set pre-charge period
     0xDB, // Set VCOMH deselect level
     0x40, // Set VCOMH deselect level
+#if DISPLAY_PANEL == DISPLAY_PANEL_72X40
+    0xAD, // Set internal IREF
+    0x30, // Internal IREF for 0.42" panels
+#endif //DISPLAY_PANEL == DISPLAY_PANEL_72X40
     0xA4, // Entire display on
     0xA6, // Normal display
     0x2E, // Deactivate scroll
     0xAF  // Display on
   };
 
+#define SHIFT_COMMAND_1 (COLUMN_OFFSET & 0x0F)
+#define SHIFT_COMMAND_2 ((COLUMN_OFFSET >> 4) & 0x0F)
+
 // Set default display configuration
 display_config_t display_config = {
   .name = "SSD1306 I2C",
   .i2c_address = 0x3C,
-  .width = 128,
-  .height = 64,
-  .pages = 8,
+  .width = PANEL_WIDTH,
+  .height = PANEL_HEIGHT,
+  .pages = PANEL_HEIGHT / 8,
   .back_buffer = NULL,
   .front_buffer = NULL,
   .buffer_size = 0,
   .command_head = 0x80,
   .data_head = 0x40,
+  .column_offset = COLUMN_OFFSET,
   .init_sequence_length = sizeof(ssd1306_init_sequence),
   .init_sequence = (uint8_t *)ssd1306_init_sequence,
   // Default font pointers
   .display_small_font = oled_9,
   .display_medium_font = oled_9,
   .display_big_font = oled_11,
+#if PANEL_LOGO
   .logo_width = LOGO_WIDTH,
   .logo_height= LOGO_HEIGH, 
   .logo_rle = false,
   .logo_bits = logo_bits
+#else
+  .logo_width = 0,
+  .logo_height= 0, 
+  .logo_rle = false,
+  .logo_bits = NULL
+#endif //PANEL_LOGO
 };
 
-#define SHIFT_COMMAND_1 0
-#define SHIFT_COMMAND_2 0
-
 #endif //SSD1306_I2C_H
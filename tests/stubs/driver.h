@@ -0,0 +1,68 @@
+/*
+
+  driver.h - host stand-in of the grblHAL driver header for the plugin tests.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifndef DISPLAY_ENABLE
+#define DISPLAY_ENABLE 33
+#endif //DISPLAY_ENABLE
+
+#define DISPLAY_DRIVER_SH1106 1
+#define DISPLAY_DRIVER_SSD1306 2
+
+#ifndef N_AXIS
+#define N_AXIS 3
+#endif //N_AXIS
+
+#define PROGMEM
+#define On 1
+#define Off 0
+
+typedef struct {
+    uint8_t address;
+    uint8_t cmd_bytes;
+    uint8_t cmd;
+    uint8_t *data;
+    int16_t count;
+    bool no_block;
+} i2c_transfer_t;
+
+typedef struct {
+    bool started;
+} i2c_cap_t;
+
+bool i2c_transfer(i2c_transfer_t *transfer, bool read);
+bool i2c_probe(uint8_t i2c_address);
+i2c_cap_t i2c_start(void);
+
+// Font and image reads from flash can be counted by the tests
+#if HOST_FLASH_READS
+uint8_t host_flash_read(const void *address);
+#define pgm_read_byte(address) host_flash_read(address)
+#endif //HOST_FLASH_READS
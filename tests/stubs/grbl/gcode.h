@@ -0,0 +1,35 @@
+/*
+  gcode.h - host stand-in of the grblHAL parser state used by the plugin tests.
+*/
+
+#pragma once
+
+#include "grbl.h"
+
+typedef enum {
+    CoordinateSystem_G54 = 0,
+    CoordinateSystem_G55,
+    CoordinateSystem_G56,
+    CoordinateSystem_G57,
+    CoordinateSystem_G58,
+    CoordinateSystem_G59,
+    CoordinateSystem_G59_1,
+    CoordinateSystem_G59_2,
+    CoordinateSystem_G59_3,
+    N_WorkCoordinateSystems
+} coord_system_id_t;
+
+typedef struct {
+    coord_system_id_t id;
+    float xyz[N_AXIS];
+} coord_system_t;
+
+typedef struct {
+    coord_system_t coord_system;
+} gc_modal_t;
+
+typedef struct {
+    gc_modal_t modal;
+} parser_state_t;
+
+extern parser_state_t gc_state;
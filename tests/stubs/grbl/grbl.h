@@ -0,0 +1,54 @@
+/*
+  grbl.h - host stand-in of the grblHAL core types used by the plugin tests.
+
+  Only the members the plugin uses are declared.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "driver.h"
+
+typedef uint32_t sys_state_t;
+typedef int status_code_t;
+
+#define Status_OK 0
+#define Status_InvalidStatement 3
+#define Status_SettingValueOutOfRange 33
+#define Status_FileOpenFailed 60
+
+enum {
+    STATE_IDLE = 0,
+    STATE_ALARM = 1,
+    STATE_CHECK_MODE = 2,
+    STATE_HOMING = 4,
+    STATE_CYCLE = 8,
+    STATE_HOLD = 16,
+    STATE_JOG = 32,
+    STATE_SAFETY_DOOR = 64,
+    STATE_SLEEP = 128,
+    STATE_ESTOP = 256,
+    STATE_TOOL_CHANGE = 512
+};
+
+#define ASCII_EOL "\r\n"
+#define AXES_BITMASK ((1 << N_AXIS) - 1)
+#define INCH_PER_MM 0.0393701f
+#define N_DECIMAL_COORDVALUE_INCH 4
+#define N_DECIMAL_COORDVALUE_MM 3
+#define STRLEN_COORDVALUE 12
+
+typedef void (*task_ptr)(void *data);
+
+bool task_add_delayed(task_ptr fn, void *data, uint32_t delay_ms);
+bool task_add_immediate(task_ptr fn, void *data);
+void task_delete(task_ptr fn, void *data);
+bool task_run_on_startup(task_ptr fn, void *data);
+
+void report_warning(void *message);
+void report_plugin(const char *name, const char *version);
+
+char *ftoa(float n, uint8_t decimal_places);
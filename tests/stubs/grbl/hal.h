@@ -0,0 +1,142 @@
+/*
+  hal.h - host stand-in of the grblHAL HAL structure used by the plugin tests.
+
+  Only the members the plugin uses are declared.
+*/
+
+#pragma once
+
+#include "grbl.h"
+#include "settings.h"
+
+typedef void (*on_report_options_ptr)(bool newopt);
+typedef void (*on_state_change_ptr)(sys_state_t state);
+typedef bool (*enqueue_gcode_ptr)(char *data);
+typedef void (*stream_write_ptr)(const char *s);
+
+typedef struct {
+    stream_write_ptr write;
+    stream_write_ptr write_all;
+} io_stream_t;
+
+typedef union {
+    uint8_t mask;
+    struct {
+        uint8_t x :1,
+                y :1,
+                z :1;
+    };
+} axes_signals_t;
+
+typedef struct {
+    axes_signals_t min;
+} limit_signals_t;
+
+typedef struct {
+    limit_signals_t (*get_state)(void);
+} limits_ptrs_t;
+
+typedef union {
+    uint8_t value;
+    struct {
+        uint8_t flood :1,
+                mist  :1;
+    };
+} coolant_state_t;
+
+typedef struct {
+    coolant_state_t (*get_state)(void);
+} coolant_ptrs_t;
+
+typedef union {
+    uint8_t value;
+    struct {
+        uint8_t on  :1,
+                ccw :1;
+    };
+} spindle_state_t;
+
+typedef struct spindle_ptrs spindle_ptrs_t;
+
+struct spindle_ptrs {
+    spindle_state_t (*get_state)(spindle_ptrs_t *spindle);
+};
+
+typedef struct {
+    int (*memcpy_to_nvs)(uint32_t dest, uint8_t *source, size_t size, bool with_checksum);
+    int (*memcpy_from_nvs)(uint8_t *dest, uint32_t source, size_t size, bool with_checksum);
+} nvs_io_t;
+
+typedef enum {
+    Port_Analog = 0,
+    Port_Digital = 1
+} io_port_type_t;
+
+typedef enum {
+    Port_Input = 0,
+    Port_Output = 1
+} io_port_direction_t;
+
+typedef enum {
+    WaitMode_Immediate = 0,
+    WaitMode_Rise,
+    WaitMode_Fall,
+    WaitMode_High,
+    WaitMode_Low
+} wait_mode_t;
+
+typedef enum {
+    IRQ_Mode_None = 0,
+    IRQ_Mode_Rising = 1,
+    IRQ_Mode_Falling = 2,
+    IRQ_Mode_Change = 3
+} pin_irq_mode_t;
+
+typedef struct {
+    int32_t (*wait_on_input)(io_port_type_t type, uint8_t port, wait_mode_t wait_mode, float timeout);
+} io_port_t;
+
+typedef struct {
+    io_port_t port;
+    io_stream_t stream;
+    limits_ptrs_t limits;
+    coolant_ptrs_t coolant;
+    uint32_t (*get_elapsed_ticks)(void);
+    void (*irq_enable)(void);
+    void (*irq_disable)(void);
+    nvs_io_t nvs;
+} grbl_hal_t;
+
+typedef struct {
+    on_report_options_ptr on_report_options;
+    on_state_change_ptr on_state_change;
+    enqueue_gcode_ptr enqueue_gcode;
+} grbl_t;
+
+typedef struct {
+    float steps_per_mm;
+} axis_settings_t;
+
+typedef struct {
+    struct {
+        uint8_t pin_state;
+    } status_report;
+    struct {
+        uint8_t report_inches;
+    } flags;
+    axis_settings_t axis[N_AXIS];
+} settings_t;
+
+typedef struct {
+    int32_t position[N_AXIS];
+    sys_state_t state;
+} system_t;
+
+extern grbl_hal_t hal;
+extern grbl_t grbl;
+extern settings_t settings;
+extern system_t sys;
+
+axes_signals_t limit_signals_merge(limit_signals_t signals);
+spindle_ptrs_t *spindle_get(uint_fast8_t spindle_num);
+float st_get_realtime_rate(void);
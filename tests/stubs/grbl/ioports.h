@@ -0,0 +1,13 @@
+/*
+  ioports.h - host stand-in of the grblHAL auxiliary ports API used by the plugin tests.
+*/
+
+#pragma once
+
+#include "hal.h"
+
+typedef void (*ioport_interrupt_callback_ptr)(uint8_t port, bool state);
+
+bool ioport_claim(io_port_type_t type, io_port_direction_t dir, uint8_t *port, const char *description);
+bool ioport_enable_irq(uint8_t port, pin_irq_mode_t irq_mode, ioport_interrupt_callback_ptr handler);
+uint8_t ioports_available(io_port_type_t type, io_port_direction_t dir);
@@ -0,0 +1,17 @@
+/*
+  nvs_buffer.h - host stand-in of the grblHAL non volatile storage API used by the plugin tests.
+*/
+
+#pragma once
+
+#include "grbl.h"
+
+typedef uint32_t nvs_address_t;
+
+typedef enum {
+    NVS_TransferResult_Failed = 0,
+    NVS_TransferResult_Busy,
+    NVS_TransferResult_OK
+} nvs_transfer_result_t;
+
+nvs_address_t nvs_alloc(size_t size);
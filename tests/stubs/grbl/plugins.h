@@ -0,0 +1,5 @@
+/*
+  plugins.h - host stand-in, no plugin declarations are needed by the tests.
+*/
+
+#pragma once
@@ -0,0 +1,7 @@
+/*
+  report.h - host stand-in, the report functions are declared in grbl.h.
+*/
+
+#pragma once
+
+#include "grbl.h"
@@ -0,0 +1,100 @@
+/*
+  settings.h - host stand-in of the grblHAL settings API used by the plugin tests.
+*/
+
+#pragma once
+
+#include "grbl.h"
+
+typedef enum {
+    Setting_ReportInches = 13,
+    Setting_UserDefined_0 = 450,
+    Setting_UserDefined_1,
+    Setting_UserDefined_2,
+    Setting_UserDefined_3,
+    Setting_UserDefined_4,
+    Setting_UserDefined_5,
+    Setting_UserDefined_6,
+    Setting_UserDefined_7,
+    Setting_UserDefined_8,
+    Setting_UserDefined_9
+} setting_id_t;
+
+typedef enum {
+    Group_Root = 0,
+    Group_General,
+    Group_UserSettings
+} setting_group_t;
+
+typedef enum {
+    Format_Bool = 0,
+    Format_Bitfield,
+    Format_XBitfield,
+    Format_RadioButtons,
+    Format_AxisMask,
+    Format_Integer,
+    Format_Decimal,
+    Format_String,
+    Format_Password,
+    Format_IPv4,
+    Format_Int8,
+    Format_Int16
+} setting_datatype_t;
+
+typedef enum {
+    Setting_NonCore = 0,
+    Setting_NonCoreFn,
+    Setting_IsExtended,
+    Setting_IsExtendedFn,
+    Setting_IsLegacy,
+    Setting_IsLegacyFn
+} setting_type_t;
+
+typedef status_code_t (*setting_set_int_ptr)(setting_id_t id, uint_fast16_t value);
+typedef uint32_t (*setting_get_int_ptr)(setting_id_t id);
+typedef bool (*setting_is_available_ptr)(const void *setting, uint_fast16_t offset);
+
+typedef struct {
+    setting_id_t id;
+    setting_group_t group;
+    const char *name;
+    const char *unit;
+    setting_datatype_t datatype;
+    const char *format;
+    const char *min_value;
+    const char *max_value;
+    setting_type_t type;
+    void *value;
+    void *get_value;
+    setting_is_available_ptr is_available;
+} setting_detail_t;
+
+typedef struct {
+    setting_group_t parent;
+    setting_group_t id;
+    const char *name;
+} setting_group_detail_t;
+
+typedef struct {
+    setting_id_t id;
+    const char *description;
+} setting_descr_t;
+
+typedef void (*settings_save_ptr)(void);
+typedef void (*settings_load_ptr)(void);
+typedef void (*settings_restore_ptr)(void);
+
+typedef struct setting_details {
+    const uint8_t n_groups;
+    const setting_group_detail_t *groups;
+    const uint8_t n_settings;
+    const setting_detail_t *settings;
+    const uint8_t n_descriptions;
+    const setting_descr_t *descriptions;
+    settings_save_ptr save;
+    settings_load_ptr load;
+    settings_restore_ptr restore;
+} setting_details_t;
+
+void settings_register(setting_details_t *details);
+status_code_t settings_store_setting(setting_id_t id, char *svalue);
@@ -0,0 +1,9 @@
+/*
+  state_machine.h - host stand-in of the grblHAL state machine API used by the plugin tests.
+*/
+
+#pragma once
+
+#include "grbl.h"
+
+sys_state_t state_get(void);
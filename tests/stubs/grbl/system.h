@@ -0,0 +1,40 @@
+/*
+  system.h - host stand-in of the grblHAL system commands API used by the plugin tests.
+*/
+
+#pragma once
+
+#include "hal.h"
+
+typedef status_code_t (*sys_command_ptr)(sys_state_t state, char *args);
+
+typedef union {
+    uint8_t flags;
+    struct {
+        uint8_t noargs               :1,
+                allow_blocking       :1,
+                help_fully_described :1,
+                unused               :5;
+    };
+} sys_command_flags_t;
+
+typedef union {
+    const char *str;
+    const char *(*fn)(const char *command);
+} sys_command_help_t;
+
+typedef struct {
+    const char *command;
+    sys_command_ptr execute;
+    sys_command_flags_t flags;
+    sys_command_help_t help;
+} sys_command_t;
+
+typedef struct sys_commands_str {
+    const uint8_t n_commands;
+    const sys_command_t *commands;
+    struct sys_commands_str *next;
+} sys_commands_t;
+
+void system_register_commands(sys_commands_t *commands);
+void system_convert_array_steps_to_mpos(float *position, int32_t *steps);
@@ -0,0 +1,7 @@
+/*
+  task.h - host stand-in, the task API is declared in grbl.h.
+*/
+
+#pragma once
+
+#include "grbl.h"
@@ -0,0 +1,18 @@
+/*
+  vfs.h - host stand-in of the grblHAL virtual file system, backed by a host directory.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include "grbl.h"
+
+typedef struct {
+    FILE *handle;
+    size_t size;
+} vfs_file_t;
+
+vfs_file_t *vfs_open(const char *filename, const char *mode);
+void vfs_close(vfs_file_t *file);
+size_t vfs_read(void *buffer, size_t size, size_t count, vfs_file_t *file);
+int vfs_seek(vfs_file_t *file, uint32_t offset);
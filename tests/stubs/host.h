@@ -0,0 +1,81 @@
+/*
+
+  host.h - host side of the grblHAL stand-ins used by the plugin tests.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include "driver.h"
+#include "grbl/hal.h"
+#include "grbl/system.h"
+
+// Controller memory rebuilt from the I2C traffic: 8 pages of 256 columns,
+// columns outside the panel are never written by a correct driver
+#define HOST_PANEL_PAGES 8
+#define HOST_PANEL_COLUMNS 256
+
+// Simulated bus: 400 kHz, 9 clocks per byte, about 2 clocks for start and stop
+#define HOST_BUS_KHZ 400
+#define HOST_BUS_US(bytes, transactions) ((((bytes) * 9.0) + ((transactions) * 2.0)) * 1000.0 / HOST_BUS_KHZ)
+
+typedef struct {
+    uint32_t bytes;           // Bytes on the bus, address and control bytes included
+    uint32_t transactions;    // Write transactions
+    uint32_t max_transaction; // Longest transaction in bytes, address byte included
+} host_bus_t;
+
+extern uint8_t host_panel[HOST_PANEL_PAGES][HOST_PANEL_COLUMNS];
+extern host_bus_t host_bus;
+extern bool host_panel_present;   // Answer of i2c_probe()
+extern uint32_t host_ticks;       // Value of hal.get_elapsed_ticks() in ms
+extern const char* host_vfs_root; // Host directory holding the vfs files
+extern uint32_t host_vfs_reads;   // Calls of vfs_read()
+extern uint32_t host_flash_reads; // Calls of pgm_read_byte() when HOST_FLASH_READS is set
+extern uint32_t host_warnings;    // Calls of report_warning()
+extern setting_details_t* host_settings;
+extern sys_commands_t* host_commands;
+
+bool host_run_one_immediate(void);
+void host_run_immediate(void);
+void host_run_for(uint32_t ms);
+bool host_task_delay(task_ptr fn, uint32_t* delay);
+
+// Test checks: failures are counted and reported, the test exits with their count
+extern int host_failures;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            host_failures++; \
+        } \
+    } while (0)
+
+#define CHECK_EQUAL(actual, expected) \
+    do { \
+        long long _actual = (long long)(actual), _expected = (long long)(expected); \
+        if (_actual != _expected) { \
+            fprintf(stderr, "%s:%d: check failed: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, _actual, _expected); \
+            host_failures++; \
+        } \
+    } while (0)
+
+bool host_compare_golden(const char* name, const uint8_t* data, size_t size);
@@ -0,0 +1,415 @@
+/*
+
+  host_stubs.c - grblHAL stand-ins for running the plugin on the host.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "grbl/system.h"
+#include "grbl/vfs.h"
+#include "grbl/nvs_buffer.h"
+#include "grbl/ioports.h"
+#include "grbl/gcode.h"
+#include "grbl/state_machine.h"
+#if ETHERNET_ENABLE || WIFI_ENABLE
+#include "networking/networking.h"
+#endif //ETHERNET_ENABLE || WIFI_ENABLE
+
+#define HOST_TASKS 16
+
+typedef struct {
+    task_ptr fn;
+    void* data;
+    uint32_t due;
+} host_task_t;
+
+uint8_t host_panel[HOST_PANEL_PAGES][HOST_PANEL_COLUMNS];
+host_bus_t host_bus;
+bool host_panel_present = true;
+uint32_t host_ticks = 0;
+const char* host_vfs_root = ".";
+uint32_t host_vfs_reads = 0;
+uint32_t host_flash_reads = 0;
+uint32_t host_warnings = 0;
+setting_details_t* host_settings = NULL;
+sys_commands_t* host_commands = NULL;
+int host_failures = 0;
+
+static host_task_t immediate_tasks[HOST_TASKS];
+static uint8_t immediate_count = 0;
+static host_task_t delayed_tasks[HOST_TASKS];
+static uint8_t delayed_count = 0;
+static uint8_t panel_page = 0;
+static uint8_t panel_column = 0;
+
+static uint32_t host_get_elapsed_ticks(void) {
+    return host_ticks;
+}
+
+// No interrupts on the host
+static void host_irq(void) {
+}
+
+grbl_hal_t hal = { .get_elapsed_ticks = host_get_elapsed_ticks, .irq_enable = host_irq, .irq_disable = host_irq };
+grbl_t grbl;
+settings_t settings;
+system_t sys;
+parser_state_t gc_state;
+#if ETHERNET_ENABLE || WIFI_ENABLE
+networking_t networking;
+#endif //ETHERNET_ENABLE || WIFI_ENABLE
+
+char const* const axis_letter[N_AXIS] = {
+    "X",
+#if N_AXIS > 1
+    "Y",
+#endif
+#if N_AXIS > 2
+    "Z",
+#endif
+#if N_AXIS > 3
+    "A",
+#endif
+#if N_AXIS > 4
+    "B",
+#endif
+#if N_AXIS > 5
+    "C",
+#endif
+};
+
+// --------------------------------------------------------
+// I2C bus, decoded as SSD1306 / SH1106 commands and data
+// --------------------------------------------------------
+
+static void panel_command(uint8_t command) {
+    if ((command & 0xF0) == 0xB0) {
+        panel_page = command & 0x07;
+    } else if ((command & 0xF0) == 0x00) {
+        panel_column = (panel_column & 0xF0) | (command & 0x0F);
+    } else if ((command & 0xF0) == 0x10) {
+        panel_column = (panel_column & 0x0F) | ((command & 0x0F) << 4);
+    }
+}
+
+// The control byte selects commands or data, Co set means a single byte
+// followed by a new control byte, Co clear means the rest of the transfer
+bool i2c_transfer(i2c_transfer_t* transfer, bool read) {
+    uint32_t length = transfer->count + 2;
+    host_bus.bytes += length;
+    host_bus.transactions++;
+    if (length > host_bus.max_transaction) {
+        host_bus.max_transaction = length;
+    }
+    uint8_t control = transfer->cmd;
+    bool expect_control = false;
+    for (int16_t i = 0; i < transfer->count; i++) {
+        uint8_t byte = transfer->data[i];
+        if (expect_control) {
+            control = byte;
+            expect_control = false;
+            continue;
+        }
+        if (control & 0x40) {
+            host_panel[panel_page][panel_column++] = byte;
+        } else {
+            panel_command(byte);
+        }
+        if (control & 0x80) {
+            expect_control = true;
+        }
+    }
+    return true;
+}
+
+bool i2c_probe(uint8_t i2c_address) {
+    return host_panel_present;
+}
+
+i2c_cap_t i2c_start(void) {
+    i2c_cap_t cap = { .started = true };
+    return cap;
+}
+
+// --------------------------------------------------------
+// Tasks, run against a simulated millisecond clock
+// --------------------------------------------------------
+
+bool task_add_immediate(task_ptr fn, void* data) {
+    if (immediate_count == HOST_TASKS) {
+        return false;
+    }
+    immediate_tasks[immediate_count].fn = fn;
+    immediate_tasks[immediate_count].data = data;
+    immediate_count++;
+    return true;
+}
+
+bool task_add_delayed(task_ptr fn, void* data, uint32_t delay_ms) {
+    if (delayed_count == HOST_TASKS) {
+        return false;
+    }
+    delayed_tasks[delayed_count].fn = fn;
+    delayed_tasks[delayed_count].data = data;
+    delayed_tasks[delayed_count].due = host_ticks + delay_ms;
+    delayed_count++;
+    return true;
+}
+
+void task_delete(task_ptr fn, void* data) {
+    for (uint8_t i = 0; i < delayed_count; i++) {
+        if (delayed_tasks[i].fn == fn && delayed_tasks[i].data == data) {
+            delayed_tasks[i] = delayed_tasks[--delayed_count];
+            return;
+        }
+    }
+}
+
+bool task_run_on_startup(task_ptr fn, void* data) {
+    return task_add_immediate(fn, data);
+}
+
+bool host_run_one_immediate(void) {
+    if (immediate_count == 0) {
+        return false;
+    }
+    host_task_t task = immediate_tasks[0];
+    memmove(&immediate_tasks[0], &immediate_tasks[1], --immediate_count * sizeof(host_task_t));
+    task.fn(task.data);
+    return true;
+}
+
+void host_run_immediate(void) {
+    while (host_run_one_immediate());
+}
+
+// Advances the clock, running the delayed tasks in due order
+void host_run_for(uint32_t ms) {
+    uint32_t end = host_ticks + ms;
+    for (;;) {
+        host_run_immediate();
+        int8_t next = -1;
+        for (uint8_t i = 0; i < delayed_count; i++) {
+            if ((int32_t)(end - delayed_tasks[i].due) >= 0 &&
+                (next < 0 || (int32_t)(delayed_tasks[next].due - delayed_tasks[i].due) > 0)) {
+                next = i;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+        host_task_t task = delayed_tasks[next];
+        memmove(&delayed_tasks[next], &delayed_tasks[next + 1], (--delayed_count - next) * sizeof(host_task_t));
+        if ((int32_t)(task.due - host_ticks) > 0) {
+            host_ticks = task.due;
+        }
+        task.fn(task.data);
+    }
+    host_ticks = end;
+}
+
+bool host_task_delay(task_ptr fn, uint32_t* delay) {
+    for (uint8_t i = 0; i < delayed_count; i++) {
+        if (delayed_tasks[i].fn == fn) {
+            if (delay) {
+                *delay = delayed_tasks[i].due - host_ticks;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t host_flash_read(const void* address) {
+    host_flash_reads++;
+    return *(const uint8_t*)address;
+}
+
+// --------------------------------------------------------
+// Virtual file system, files are read from host_vfs_root
+// --------------------------------------------------------
+
+vfs_file_t* vfs_open(const char* filename, const char* mode) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s%s", host_vfs_root, filename);
+    FILE* handle = fopen(path, "rb");
+    if (handle == NULL) {
+        return NULL;
+    }
+    vfs_file_t* file = malloc(sizeof(vfs_file_t));
+    file->handle = handle;
+    fseek(handle, 0, SEEK_END);
+    file->size = ftell(handle);
+    fseek(handle, 0, SEEK_SET);
+    return file;
+}
+
+void vfs_close(vfs_file_t* file) {
+    fclose(file->handle);
+    free(file);
+}
+
+size_t vfs_read(void* buffer, size_t size, size_t count, vfs_file_t* file) {
+    host_vfs_reads++;
+    return fread(buffer, size, count, file->handle);
+}
+
+int vfs_seek(vfs_file_t* file, uint32_t offset) {
+    return offset > file->size ? -1 : fseek(file->handle, offset, SEEK_SET);
+}
+
+// --------------------------------------------------------
+// Settings and non volatile storage
+// --------------------------------------------------------
+
+static uint8_t nvs_memory[256];
+static bool nvs_valid = false;
+
+static int nvs_write(uint32_t dest, uint8_t* source, size_t size, bool with_checksum) {
+    memcpy(&nvs_memory[dest], source, size);
+    nvs_valid = true;
+    return NVS_TransferResult_OK;
+}
+
+static int nvs_read(uint8_t* dest, uint32_t source, size_t size, bool with_checksum) {
+    if (!nvs_valid) {
+        return NVS_TransferResult_Failed;
+    }
+    memcpy(dest, &nvs_memory[source], size);
+    return NVS_TransferResult_OK;
+}
+
+nvs_address_t nvs_alloc(size_t size) {
+    hal.nvs.memcpy_to_nvs = nvs_write;
+    hal.nvs.memcpy_from_nvs = nvs_read;
+    return 16;
+}
+
+void settings_register(setting_details_t* details) {
+    host_settings = details;
+    details->load();
+}
+
+status_code_t settings_store_setting(setting_id_t id, char* svalue) {
+    if (id == Setting_ReportInches) {
+        settings.flags.report_inches = *svalue == '1';
+    }
+    return Status_OK;
+}
+
+// --------------------------------------------------------
+// Core services
+// --------------------------------------------------------
+
+void system_register_commands(sys_commands_t* commands) {
+    host_commands = commands;
+}
+
+void system_convert_array_steps_to_mpos(float* position, int32_t* steps) {
+    for (uint8_t i = 0; i < N_AXIS; i++) {
+        position[i] = steps[i] / 1000.0f;
+    }
+}
+
+char* ftoa(float n, uint8_t decimal_places) {
+    static char buffer[STRLEN_COORDVALUE + 8];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimal_places, n);
+    return buffer;
+}
+
+axes_signals_t limit_signals_merge(limit_signals_t signals) {
+    return signals.min;
+}
+
+static spindle_state_t spindle_state(spindle_ptrs_t* spindle) {
+    spindle_state_t state = { .on = 1 };
+    return state;
+}
+
+spindle_ptrs_t* spindle_get(uint_fast8_t spindle_num) {
+    static spindle_ptrs_t spindle = { .get_state = spindle_state };
+    return &spindle;
+}
+
+float st_get_realtime_rate(void) {
+    return 0.0f;
+}
+
+sys_state_t state_get(void) {
+    return sys.state;
+}
+
+bool ioport_claim(io_port_type_t type, io_port_direction_t dir, uint8_t* port, const char* description) {
+    return false;
+}
+
+bool ioport_enable_irq(uint8_t port, pin_irq_mode_t irq_mode, ioport_interrupt_callback_ptr handler) {
+    return false;
+}
+
+uint8_t ioports_available(io_port_type_t type, io_port_direction_t dir) {
+    return 0;
+}
+
+void report_warning(void* message) {
+    host_warnings++;
+    fprintf(stderr, "warning: %s\n", (const char*)message);
+}
+
+void report_plugin(const char* name, const char* version) {
+}
+
+// --------------------------------------------------------
+// Golden files, rewritten instead of compared when UPDATE_GOLDEN is set
+// --------------------------------------------------------
+
+bool host_compare_golden(const char* name, const uint8_t* data, size_t size) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", GOLDEN_DIR, name);
+    if (getenv("UPDATE_GOLDEN")) {
+        FILE* golden = fopen(path, "wb");
+        bool written = golden && fwrite(data, 1, size, golden) == size;
+        if (golden) {
+            fclose(golden);
+        }
+        return written;
+    }
+    FILE* golden = fopen(path, "rb");
+    if (golden == NULL) {
+        fprintf(stderr, "%s: missing golden file\n", path);
+        return false;
+    }
+    bool same = true;
+    size_t i = 0;
+    int byte;
+    for (; i < size && (byte = fgetc(golden)) != EOF; i++) {
+        if (byte != data[i]) {
+            fprintf(stderr, "%s: byte %zu is 0x%02X, expected 0x%02X\n", path, i, data[i], byte);
+            same = false;
+            break;
+        }
+    }
+    if (same && (i != size || fgetc(golden) != EOF)) {
+        fprintf(stderr, "%s: size differs from %zu bytes\n", path, size);
+        same = false;
+    }
+    fclose(golden);
+    return same;
+}
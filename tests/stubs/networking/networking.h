@@ -0,0 +1,32 @@
+/*
+  networking.h - host stand-in of the grblHAL networking API used by the plugin tests.
+*/
+
+#pragma once
+
+#include "grbl/grbl.h"
+
+typedef struct {
+    struct {
+        uint8_t ap_started  :1,
+                ip_aquired  :1;
+    } changed;
+    struct {
+        uint8_t ap_started :1;
+    } flags;
+} network_status_t;
+
+typedef void (*on_network_event_ptr)(const char *interface, network_status_t status);
+
+typedef struct {
+    struct {
+        char ip[16];
+    } status;
+} network_info_t;
+
+typedef struct {
+    on_network_event_ptr event;
+    network_info_t *(*get_info)(const char *interface);
+} networking_t;
+
+extern networking_t networking;
@@ -0,0 +1,105 @@
+/*
+
+  test_animation.c - animation frames through the refresh gate.
+
+  A 16 x 8 animation of two deltas is played on the simulated panel. The
+  frames must reach the panel in turn, nothing must be sent while the bus
+  is held or the display is off, and the panel must show the last frame
+  once the bus is released or the display turned on.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "oled_display.h"
+
+#define X 10
+#define PAGE 2
+#define DELAY_MS 50
+
+// Width, height, frames, delay in 10 ms, key frame, then for each delta:
+// span count, spans of page, column, length and bytes
+static const uint8_t animation[] = {
+    16, 8, 3, DELAY_MS / 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 4, 0xFF, 0xFF, 0xFF, 0xFF,
+    1, 0, 4, 4, 0x0F, 0x0F, 0x0F, 0x0F
+};
+
+static uint16_t panel_differences(void) {
+    uint16_t different = 0;
+    for (uint8_t page = 0; page < display_config.pages; page++) {
+        for (uint8_t column = 0; column < display_config.width; column++) {
+            if (host_panel[page][column + display_config.column_offset] != display_config.back_buffer[(page * display_config.width) + column]) {
+                different++;
+            }
+        }
+    }
+    return different;
+}
+
+static uint8_t panel_at(uint8_t column) {
+    return host_panel[PAGE][X + column + display_config.column_offset];
+}
+
+int main(void) {
+    CHECK(display_oled_init());
+    host_run_immediate();
+
+    // Frames in turn
+    display_clear();
+    CHECK(display_play_animation(animation, X, PAGE, 1));
+    display_refresh();
+    host_run_for(DELAY_MS);
+    CHECK_EQUAL(panel_at(0), 0xFF);
+    CHECK_EQUAL(panel_at(4), 0x00);
+    host_run_for(DELAY_MS);
+    CHECK_EQUAL(panel_at(4), 0x0F);
+    CHECK(!display_animation_playing());
+    CHECK_EQUAL(panel_differences(), 0);
+
+    // Held bus: the frames wait for the release
+    display_clear();
+    display_refresh();
+    CHECK(display_play_animation(animation, X, PAGE, 1));
+    display_hold_bus(true);
+    uint32_t bytes = host_bus.bytes;
+    host_run_for(DELAY_MS * 3);
+    CHECK(!display_animation_playing());
+    CHECK_EQUAL(host_bus.bytes, bytes);
+    display_hold_bus(false);
+    host_run_immediate();
+    CHECK_EQUAL(panel_differences(), 0);
+
+    // Display off: nothing is sent until it is turned on
+    display_clear();
+    display_refresh();
+    CHECK(display_set_power(DISPLAY_POWER_OFF));
+    CHECK(display_play_animation(animation, X, PAGE, 1));
+    bytes = host_bus.bytes;
+    host_run_for(DELAY_MS * 3);
+    CHECK_EQUAL(host_bus.bytes, bytes);
+    CHECK(display_set_power(DISPLAY_POWER_ON));
+    host_run_immediate();
+    CHECK_EQUAL(panel_differences(), 0);
+    CHECK_EQUAL(panel_at(0), 0xFF);
+    CHECK_EQUAL(panel_at(4), 0x0F);
+
+    return host_failures;
+}
@@ -0,0 +1,134 @@
+/*
+
+  test_bus_split.c - display transfers split for other devices of the bus.
+
+  Random DRO frames and full screen redraws are refreshed on the simulated
+  400 kHz bus. The panel must always end equal to the frame, transactions
+  must not exceed DISPLAY_I2C_CHUNK data bytes and a foreground call must not
+  send more than DISPLAY_REFRESH_BUDGET data bytes. The display throughput
+  and the latency added to other devices (the longest transaction) are
+  reported.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "oled_display.h"
+
+#define FRAMES 500
+
+static uint16_t panel_differences(void) {
+    uint16_t different = 0;
+    for (uint8_t page = 0; page < display_config.pages; page++) {
+        for (uint8_t column = 0; column < display_config.width; column++) {
+            if (host_panel[page][column + display_config.column_offset] != display_config.back_buffer[(page * display_config.width) + column]) {
+                different++;
+            }
+        }
+    }
+    return different;
+}
+
+static uint32_t calls = 0, worst_call = 0, worst_call_data = 0;
+
+// Runs a refresh or a foreground loop, keeping the worst bus use
+static bool foreground_call(bool (*call)(void)) {
+    const display_stats_t* stats = display_get_stats();
+    uint32_t bytes = host_bus.bytes, data = stats->i2c_data_bytes;
+    bool done = call();
+    if (done) {
+        calls++;
+    }
+    if (host_bus.bytes - bytes > worst_call) {
+        worst_call = host_bus.bytes - bytes;
+    }
+    if (stats->i2c_data_bytes - data > worst_call_data) {
+        worst_call_data = stats->i2c_data_bytes - data;
+    }
+    return done;
+}
+
+int main(void) {
+    const display_stats_t* stats = display_get_stats();
+
+    CHECK(display_oled_init());
+    host_run_immediate();
+    CHECK_EQUAL(panel_differences(), 0);
+
+    host_bus.max_transaction = 0;
+    host_bus_t start = host_bus;
+    uint32_t data_start = stats->i2c_data_bytes;
+    uint32_t frames_wrong = 0;
+    srand(1);
+    for (uint16_t frame = 0; frame < FRAMES; frame++) {
+        char text[16];
+        display_clear();
+        display_set_font(DISPLAY_FONT_BIG);
+        snprintf(text, sizeof(text), "%d.%03d", rand() % 999, rand() % 1000);
+        display_draw_string(rand() % 60, rand() % 40, text);
+        if (frame % 50 == 0) {
+            display_fill_rect(0, 0, display_config.width, display_config.height);
+        }
+
+        // The refresh, then the foreground loops sending what it left
+        foreground_call(display_refresh);
+        while (foreground_call(host_run_one_immediate));
+        if (panel_differences()) {
+            frames_wrong++;
+        }
+    }
+
+    uint32_t bytes = host_bus.bytes - start.bytes;
+    uint32_t data = stats->i2c_data_bytes - data_start;
+    double bus_us = HOST_BUS_US(bytes, host_bus.transactions - start.transactions);
+    printf("chunk %u budget %u: %u data bytes in %u transactions, %u foreground calls\n", DISPLAY_I2C_CHUNK, DISPLAY_REFRESH_BUDGET,
+           data, host_bus.transactions - start.transactions, calls);
+    printf("throughput %.1f kB/s, latency added to other devices %.2f ms, worst foreground call %.2f ms\n",
+           data / bus_us * 1000.0, HOST_BUS_US(host_bus.max_transaction, 1) / 1000.0, HOST_BUS_US(worst_call, 0) / 1000.0);
+
+    CHECK_EQUAL(frames_wrong, 0);
+#if DISPLAY_I2C_CHUNK
+    // Data bytes after the address byte, the control byte and, for the first
+    // chunk of a span, the page and column commands with their heads
+    CHECK(host_bus.max_transaction <= DISPLAY_I2C_CHUNK + 2 + 6);
+#endif //DISPLAY_I2C_CHUNK
+#if DISPLAY_REFRESH_BUDGET
+    CHECK(worst_call_data <= DISPLAY_REFRESH_BUDGET);
+    CHECK(calls > FRAMES);
+#else
+    CHECK_EQUAL(calls, FRAMES);
+#endif //DISPLAY_REFRESH_BUDGET
+
+    // A held bus defers the refresh until released
+    uint32_t deferrals = stats->refresh_deferrals;
+    display_hold_bus(true);
+    display_clear();
+    display_draw_string(0, 20, "HOLD");
+    bytes = host_bus.bytes;
+    CHECK(display_refresh());
+    CHECK_EQUAL(host_bus.bytes, bytes);
+    CHECK_EQUAL(stats->refresh_deferrals, deferrals + 1);
+    CHECK(panel_differences() > 0);
+    display_hold_bus(false);
+    host_run_immediate();
+    CHECK(host_bus.bytes > bytes);
+    CHECK_EQUAL(panel_differences(), 0);
+
+    return host_failures;
+}
@@ -0,0 +1,91 @@
+/*
+
+  test_draw_strings.c - batches of strings against strings drawn one by one.
+
+  More strings than DISPLAY_STRINGS_MAX, in every alignment and color, are
+  drawn in one call: the frame must match the strings drawn one by one with
+  display_draw_string() at the left edges set in the records. With the text
+  cache, a second frame of the same strings must hit for every string and
+  must read no font byte from flash, the strings being neither converted
+  nor measured.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "oled_display.h"
+
+#define STRINGS 6
+
+static display_string_t strings[STRINGS] = {
+    { 0, 0, DISPLAY_ALIGN_LEFT, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, "X:" },
+    { 127, 0, DISPLAY_ALIGN_RIGHT, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, "-123.456" },
+    { 64, 13, DISPLAY_ALIGN_CENTER, DISPLAY_FONT_MEDIUM, DISPLAY_COLOR_BLACK, "IDLE" },
+    { 0, 30, DISPLAY_ALIGN_LEFT, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, NULL },
+    { 127, 30, DISPLAY_ALIGN_RIGHT, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, "7890.12" },
+    { 3, 45, DISPLAY_ALIGN_LEFT, DISPLAY_FONT_SMALL, DISPLAY_COLOR_WHITE, "192.168.0.1" },
+};
+
+static void draw_frame(void) {
+    display_clear();
+    display_draw_strings(strings, STRINGS);
+}
+
+int main(void) {
+    static uint8_t batch[1024];
+    const display_stats_t* stats = display_get_stats();
+
+    CHECK(display_oled_init());
+    host_run_immediate();
+
+    draw_frame();
+    memcpy(batch, display_config.back_buffer, display_config.buffer_size);
+#if DISPLAY_TEXT_CACHE_ENTRIES
+    CHECK_EQUAL(stats->text_cache_misses, STRINGS - 1);
+    CHECK_EQUAL(stats->text_cache_hits, 0);
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+
+    // Every string drawn, the ones past DISPLAY_STRINGS_MAX included
+    CHECK(strings[STRINGS - 1].width > 0);
+    display_clear();
+    for (uint8_t i = 0; i < STRINGS; i++) {
+        if (strings[i].text) {
+            display_set_font(strings[i].font);
+            display_set_color(strings[i].color);
+            display_draw_string(strings[i].left, strings[i].y, strings[i].text);
+        }
+    }
+    CHECK(!memcmp(display_config.back_buffer, batch, display_config.buffer_size));
+
+#if DISPLAY_TEXT_CACHE_ENTRIES
+    // Warm frame: copied from the cache, no font byte read
+    uint32_t hits = stats->text_cache_hits, misses = stats->text_cache_misses;
+    uint32_t reads = host_flash_reads;
+    for (uint8_t i = 0; i < STRINGS; i++) {
+        strings[i].left = strings[i].width = 0;
+    }
+    draw_frame();
+    CHECK_EQUAL(host_flash_reads - reads, 0);
+    CHECK_EQUAL(stats->text_cache_hits - hits, STRINGS - 1);
+    CHECK_EQUAL(stats->text_cache_misses, misses);
+    CHECK(!memcmp(display_config.back_buffer, batch, display_config.buffer_size));
+#endif //DISPLAY_TEXT_CACHE_ENTRIES
+
+    return host_failures;
+}
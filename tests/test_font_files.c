@@ -0,0 +1,167 @@
+/*
+
+  test_font_files.c - fonts loaded from the file system.
+
+  The built-in fonts are written to a directory used as file system, loaded
+  with display_load_font() and must draw exactly as the built-in ones. Cold
+  and warm draws of a DRO row report the file reads and host time, with and
+  without DISPLAY_GLYPH_CACHE_SLOTS.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "host.h"
+#include "oled_display.h"
+
+// Second copy of the built-in fonts, the source of the font files
+#define oled_9 file_oled_9
+#define oled_11 file_oled_11
+#include "./fonts/oled_9.h"
+#include "./fonts/oled_11.h"
+#undef oled_9
+#undef oled_11
+
+#define ROWS 1000
+
+static const char* const texts[] = { " !\"#$%&'()*+,-./0123456789:;<=>?@", "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "IDLE 192.168.0.1 X: -123.456", "ALARM", NULL };
+static const int16_t ys[] = { -5, 0, 3, 8, 16, 28, 57 };
+
+static char root[] = "/tmp/oled_fonts_XXXXXX";
+
+static bool write_file(const char* name, const char* data, size_t size) {
+    char path[64];
+    snprintf(path, sizeof(path), "%s/oled/%s", root, name);
+    FILE* file = fopen(path, "wb");
+    bool written = file && fwrite(data, 1, size, file) == size;
+    if (file) {
+        fclose(file);
+    }
+    return written;
+}
+
+static void remove_files(void) {
+    const char* const names[] = { "small.bin", "big.bin", "truncated.bin" };
+    char path[64];
+    for (uint8_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        snprintf(path, sizeof(path), "%s/oled/%s", root, names[i]);
+        remove(path);
+    }
+    snprintf(path, sizeof(path), "%s/oled", root);
+    rmdir(path);
+    rmdir(root);
+}
+
+// Draws the texts with both fonts at several positions, both colors, and compares the frames
+static void check_same_drawing(const char* builtin, const char* loaded) {
+    static uint8_t expected[1024];
+    uint16_t frames = 0, different = 0;
+    for (uint8_t color = 0; color < 2; color++) {
+        for (uint8_t yi = 0; yi < sizeof(ys) / sizeof(ys[0]); yi++) {
+            for (uint8_t t = 0; texts[t]; t++) {
+                for (int16_t x = -3; x < 2; x += 2) {
+                    for (uint8_t pass = 0; pass < 2; pass++) {
+                        display_clear();
+                        display_set_color(DISPLAY_COLOR_WHITE);
+                        if (color) {
+                            display_fill_rect(0, 0, 128, 64);
+                            display_set_color(DISPLAY_COLOR_BLACK);
+                        }
+                        display_draw_string_with_font(x, ys[yi], texts[t], pass ? loaded : builtin);
+                        if (pass == 0) {
+                            memcpy(expected, display_config.back_buffer, sizeof(expected));
+                        } else if (memcmp(expected, display_config.back_buffer, sizeof(expected)) != 0) {
+                            different++;
+                        }
+                    }
+                    frames++;
+                }
+            }
+        }
+    }
+    display_set_color(DISPLAY_COLOR_WHITE);
+    CHECK_EQUAL(different, 0);
+    CHECK(frames > 100);
+}
+
+static void draw_row(void) {
+    display_set_font(DISPLAY_FONT_SMALL);
+    display_draw_string(1, 14, "X: -123.456");
+}
+
+int main(void) {
+    char path[64];
+    CHECK(mkdtemp(root) != NULL);
+    snprintf(path, sizeof(path), "%s/oled", root);
+    CHECK(mkdir(path, 0700) == 0);
+    CHECK(write_file("small.bin", file_oled_9, sizeof(file_oled_9)));
+    CHECK(write_file("big.bin", file_oled_11, sizeof(file_oled_11)));
+    CHECK(write_file("truncated.bin", file_oled_9, sizeof(file_oled_9) / 2));
+    host_vfs_root = root;
+
+    CHECK(display_oled_init());
+    const char* builtin_small = display_config.display_small_font;
+    const char* builtin_big = display_config.display_big_font;
+
+    // Missing and truncated files leave the current font
+    CHECK(!display_load_font(DISPLAY_FONT_SMALL, "/oled/missing.bin"));
+    CHECK(!display_load_font(DISPLAY_FONT_SMALL, "/oled/truncated.bin"));
+    CHECK(display_config.display_small_font == builtin_small);
+
+    // Cold draw of a row right after loading, then warm draws
+    CHECK(display_load_font(DISPLAY_FONT_SMALL, "/oled/small.bin"));
+    CHECK(display_load_font(DISPLAY_FONT_BIG, "/oled/big.bin"));
+    CHECK(display_config.display_small_font != builtin_small);
+    CHECK(display_config.display_big_font != builtin_big);
+
+    display_clear();
+    uint32_t reads = host_vfs_reads;
+    draw_row();
+    uint32_t cold = host_vfs_reads - reads;
+    reads = host_vfs_reads;
+    draw_row();
+    uint32_t warm = host_vfs_reads - reads;
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint16_t i = 0; i < ROWS; i++) {
+        draw_row();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double row_ns = (((end.tv_sec - start.tv_sec) * 1e9) + (end.tv_nsec - start.tv_nsec)) / ROWS;
+    printf("cold row: %u file reads, warm row: %u file reads, %.0f ns\n", cold, warm, row_ns);
+
+    CHECK(cold > 0);
+#if DISPLAY_GLYPH_CACHE_SLOTS >= 16
+    CHECK_EQUAL(warm, 0);
+#else
+    CHECK_EQUAL(warm, cold);
+#endif //DISPLAY_GLYPH_CACHE_SLOTS >= 16
+
+    // Same drawing as the built-in fonts
+    check_same_drawing(builtin_small, display_config.display_small_font);
+    check_same_drawing(builtin_big, display_config.display_big_font);
+
+    remove_files();
+
+    return host_failures;
+}
@@ -0,0 +1,135 @@
+/*
+
+  test_glyph_cache.c - glyph cache output, hit rates and flash reads.
+
+  Built with and without DISPLAY_GLYPH_CACHE_SLOTS, both builds must draw
+  the same frames as the golden file. With the cache, the hit rates of the
+  DRO strings are checked and the flash reads of cold and warm passes are
+  reported with a simulated flash latency of HOST_FLASH_READ_NS per byte.
+  The cache saves the glyph decoding and shifting, the character lookups
+  still read the font in flash.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <time.h>
+
+#include "host.h"
+#include "oled_display.h"
+
+// Latency of a byte read from flash, about an external SPI flash without cache
+#ifndef HOST_FLASH_READ_NS
+#define HOST_FLASH_READ_NS 250
+#endif //HOST_FLASH_READ_NS
+
+#define FRAMES 6
+#define ROWS 1000
+
+static const char* const texts[] = { "X: -123.456", "Y:  7890.12", "Z:    -0.50", "IDLE", "192.168.0.1" };
+
+// Draws the DRO strings, returns the flash reads it took
+static uint32_t draw_texts(display_font_size_t font_size, int16_t y) {
+    uint32_t reads = host_flash_reads;
+    display_set_font(font_size);
+    for (uint8_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        display_draw_string(1, y + (i * 12), texts[i]);
+    }
+    return host_flash_reads - reads;
+}
+
+// Draws a DRO row, returns the flash reads it took
+static uint32_t draw_row(display_font_size_t font_size, int16_t y) {
+    uint32_t reads = host_flash_reads;
+    display_set_font(font_size);
+    display_draw_string(1, y, texts[0]);
+    return host_flash_reads - reads;
+}
+
+int main(void) {
+    static uint8_t frames[FRAMES][1024];
+    const display_stats_t* stats = display_get_stats();
+
+    CHECK(display_oled_init());
+
+    // Same frames with or without cache: page aligned and unaligned rows, both colors
+    uint8_t frame = 0;
+    for (display_font_size_t font_size = DISPLAY_FONT_SMALL; font_size <= DISPLAY_FONT_BIG; font_size++) {
+        for (int16_t y = 0; y < 6; y += 5) {
+            display_clear();
+            display_set_color(y ? DISPLAY_COLOR_BLACK : DISPLAY_COLOR_WHITE);
+            if (y) {
+                display_fill_rect(0, 0, 128, 64);
+            }
+            draw_texts(font_size, y);
+            memcpy(frames[frame++], display_config.back_buffer, sizeof(frames[0]));
+        }
+    }
+    display_set_color(DISPLAY_COLOR_WHITE);
+    CHECK(host_compare_golden("glyphs_128x64.bin", &frames[0][0], sizeof(frames)));
+
+    // Cold and warm passes of the same strings
+    display_clear();
+    uint32_t hits = stats->glyph_cache_hits, misses = stats->glyph_cache_misses;
+    uint32_t cold = draw_row(DISPLAY_FONT_SMALL, 14);
+    uint32_t cold_hits = stats->glyph_cache_hits - hits, cold_misses = stats->glyph_cache_misses - misses;
+    hits = stats->glyph_cache_hits;
+    misses = stats->glyph_cache_misses;
+    uint32_t warm = draw_row(DISPLAY_FONT_SMALL, 14);
+    uint32_t warm_hits = stats->glyph_cache_hits - hits, warm_misses = stats->glyph_cache_misses - misses;
+
+    printf("cold pass: %u flash reads, %.1f us, %u hits %u misses\n", cold, cold * HOST_FLASH_READ_NS / 1000.0, cold_hits, cold_misses);
+    printf("warm pass: %u flash reads, %.1f us, %u hits %u misses\n", warm, warm * HOST_FLASH_READ_NS / 1000.0, warm_hits, warm_misses);
+
+    // Host time of warm rows, to compare the builds with and without cache
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint16_t i = 0; i < ROWS; i++) {
+        draw_row(DISPLAY_FONT_SMALL, 14);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double row_ns = (((end.tv_sec - start.tv_sec) * 1e9) + (end.tv_nsec - start.tv_nsec)) / ROWS;
+    printf("warm row: %.0f ns on the host, %.0f ns with flash latency\n", row_ns, row_ns + (warm * HOST_FLASH_READ_NS));
+
+#if DISPLAY_GLYPH_CACHE_SLOTS >= 16
+    // The row needs fewer glyphs than slots: every glyph misses once, then always hits
+    CHECK_EQUAL(cold_hits, 0);
+    CHECK_EQUAL(cold_misses, 10);
+    CHECK_EQUAL(warm_misses, 0);
+    CHECK_EQUAL(warm_hits, cold_misses);
+    CHECK(warm < cold);
+
+    // Least recently used replacement: cycling more glyphs than slots never hits
+    display_clear();
+    char cycle[DISPLAY_GLYPH_CACHE_SLOTS + 2];
+    for (uint8_t i = 0; i < sizeof(cycle) - 1; i++) {
+        cycle[i] = 'A' + i;
+    }
+    cycle[sizeof(cycle) - 1] = '\0';
+    display_set_font(DISPLAY_FONT_SMALL);
+    display_draw_string_with_font(0, 40, cycle, display_config.display_small_font);
+    hits = stats->glyph_cache_hits;
+    display_draw_string_with_font(0, 40, cycle, display_config.display_small_font);
+    CHECK_EQUAL(stats->glyph_cache_hits - hits, 0);
+#else
+    CHECK_EQUAL(cold_hits + cold_misses + warm_hits + warm_misses, 0);
+    CHECK_EQUAL(warm, cold);
+#endif //DISPLAY_GLYPH_CACHE_SLOTS >= 16
+
+    return host_failures;
+}
@@ -0,0 +1,142 @@
+/*
+
+  test_gray.c - gray overlay frames on the simulated bus.
+
+  A 48 x 16 overlay, not aligned on pages, holds four 12 column zones:
+  unlit, gray plane only, both planes and canvas only. The panel memory is
+  sampled after each frame of the gray cycle, the duty of each zone must
+  match its level for DISPLAY_GRAY_FRAMES, frames must come every
+  DISPLAY_GRAY_INTERVAL ms and only the changing columns must be sent.
+  The bus time of a frame and its share of the interval are reported.
+  Held bus and gray turned off stop the frames.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "oled_display.h"
+
+#define OVERLAY_X 40
+#define OVERLAY_Y 20
+#define ZONE_WIDTH 12
+#define ZONES 4
+#define CYCLES 25
+
+// Zones of the overlay, in the order drawn
+enum { ZONE_UNLIT, ZONE_GRAY, ZONE_BOTH, ZONE_CANVAS };
+
+static bool panel_pixel(int16_t x, int16_t y) {
+    return (host_panel[y / 8][x + display_config.column_offset] >> (y % 8)) & 0x01;
+}
+
+// Lit frames of each zone over the next frames, returns the data bytes sent
+static uint32_t sample_frames(uint16_t frames, uint16_t lit[ZONES]) {
+    const display_stats_t* stats = display_get_stats();
+    uint32_t data = stats->i2c_data_bytes;
+    for (uint16_t frame = 0; frame < frames; frame++) {
+        host_run_for(DISPLAY_GRAY_INTERVAL);
+        for (uint8_t zone = 0; zone < ZONES; zone++) {
+            // Every row of the zone, across the 3 pages it covers
+            bool on = true;
+            for (int16_t y = OVERLAY_Y; y < OVERLAY_Y + 16; y++) {
+                on &= panel_pixel(OVERLAY_X + (zone * ZONE_WIDTH) + (ZONE_WIDTH / 2), y);
+            }
+            lit[zone] += on;
+        }
+    }
+    return stats->i2c_data_bytes - data;
+}
+
+int main(void) {
+    const display_stats_t* stats = display_get_stats();
+    uint16_t frames = DISPLAY_GRAY_FRAMES * CYCLES;
+    uint16_t lit[ZONES] = { 0 };
+
+    CHECK(display_oled_init());
+    host_run_immediate();
+    display_clear();
+    display_refresh();
+    host_run_immediate();
+
+    display_overlay_t* overlay = display_overlay_add(OVERLAY_X, OVERLAY_Y, ZONES * ZONE_WIDTH, 16, 1);
+    CHECK(overlay != NULL);
+    if (overlay == NULL) {
+        return host_failures;
+    }
+    CHECK(display_overlay_begin(overlay));
+    display_set_color(DISPLAY_COLOR_WHITE);
+    display_fill_rect(ZONE_BOTH * ZONE_WIDTH, 0, 2 * ZONE_WIDTH, 16);
+    display_overlay_end(overlay);
+    CHECK(display_overlay_set_gray(overlay, true));
+    CHECK(display_overlay_begin_gray(overlay));
+    display_fill_rect(ZONE_GRAY * ZONE_WIDTH, 0, 2 * ZONE_WIDTH, 16);
+    display_overlay_end(overlay);
+    display_overlay_show(overlay, true);
+    host_run_immediate();
+
+    // Duty of each level: the gray plane alone is lit one frame of the
+    // cycle, the canvas alone all frames with 2 frames and 2 of 3 with 3
+    uint32_t gray_frames = stats->gray_frames;
+    uint32_t transactions = host_bus.transactions, bytes = host_bus.bytes;
+    uint32_t data = sample_frames(frames, lit);
+    CHECK_EQUAL(stats->gray_frames - gray_frames, frames);
+    CHECK_EQUAL(lit[ZONE_UNLIT], 0);
+    CHECK_EQUAL(lit[ZONE_GRAY], CYCLES);
+    CHECK_EQUAL(lit[ZONE_CANVAS], DISPLAY_GRAY_FRAMES == 2 ? frames : frames - CYCLES);
+    CHECK_EQUAL(lit[ZONE_BOTH], frames);
+
+    // Only the zones changing between frames are sent, on the 3 pages of the overlay
+    uint16_t changing = DISPLAY_GRAY_FRAMES == 2 ? ZONE_WIDTH : 3 * ZONE_WIDTH;
+    CHECK(data <= (uint32_t)frames * changing * 3);
+    // Bus bytes of a frame given in the README, commands and heads included
+    CHECK_EQUAL((host_bus.bytes - bytes) / frames, DISPLAY_GRAY_FRAMES == 2 ? 60 : 86);
+    double frame_us = HOST_BUS_US(host_bus.bytes - bytes, host_bus.transactions - transactions) / frames;
+    printf("%u frames: %u data bytes, %u bus bytes per frame, %.2f ms of bus, %.0f%% of the %u ms interval\n", DISPLAY_GRAY_FRAMES,
+           data / frames, (host_bus.bytes - bytes) / frames, frame_us / 1000.0, frame_us / (DISPLAY_GRAY_INTERVAL * 10.0), DISPLAY_GRAY_INTERVAL);
+
+    // A held bus pauses the cycle
+    display_hold_bus(true);
+    gray_frames = stats->gray_frames;
+    bytes = host_bus.bytes;
+    host_run_for(DISPLAY_GRAY_INTERVAL * 10);
+    CHECK_EQUAL(stats->gray_frames, gray_frames);
+    CHECK_EQUAL(host_bus.bytes, bytes);
+    display_hold_bus(false);
+    host_run_for(DISPLAY_GRAY_INTERVAL * 10);
+    CHECK_EQUAL(stats->gray_frames, gray_frames + 10);
+
+    // Gray turned off: the canvas alone is shown and the frames stop
+    CHECK(display_overlay_set_gray(overlay, false));
+    host_run_for(DISPLAY_GRAY_INTERVAL * 2);
+    gray_frames = stats->gray_frames;
+    bytes = host_bus.bytes;
+    memset(lit, 0, sizeof(lit));
+    sample_frames(10, lit);
+    CHECK_EQUAL(stats->gray_frames, gray_frames);
+    CHECK_EQUAL(host_bus.bytes, bytes);
+    CHECK_EQUAL(lit[ZONE_UNLIT], 0);
+    CHECK_EQUAL(lit[ZONE_GRAY], 0);
+    CHECK_EQUAL(lit[ZONE_BOTH], 10);
+    CHECK_EQUAL(lit[ZONE_CANVAS], 10);
+
+    display_overlay_remove(overlay);
+    host_run_immediate();
+
+    return host_failures;
+}
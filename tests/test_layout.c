@@ -0,0 +1,142 @@
+/*
+
+  test_layout.c - layout frames of the compiled panel against golden files.
+
+  The screen is drawn by the plugin with every field shown: positions,
+  endstops, spindle icon and, with networking, the IP address. The front
+  buffer must match the golden frame of the panel, axis count and network
+  option, the panel memory must hold it from column_offset on (28 for the
+  72 x 40 panel) and the columns outside the panel must stay unwritten.
+  The frame with the optional fields hidden by the layout setting has its
+  own golden file. The text rows of the layout must all be kept and used.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "oled_display.h"
+
+#ifndef ETHERNET_ENABLE
+#define ETHERNET_ENABLE 0
+#endif //ETHERNET_ENABLE
+
+#if ETHERNET_ENABLE
+#include "networking/networking.h"
+#endif //ETHERNET_ENABLE
+
+// Value never sent by the driver, left in the columns outside the panel
+#define UNWRITTEN 0xA5
+
+void display_init(void);
+
+#if ETHERNET_ENABLE
+static network_info_t network_info = { .status = { .ip = "192.168.1.120" } };
+
+static network_info_t* get_info(const char* interface) {
+    return &network_info;
+}
+#endif //ETHERNET_ENABLE
+
+// X and Z endstops triggered
+static limit_signals_t get_limits(void) {
+    limit_signals_t signals = { 0 };
+    signals.min.mask = 0x05;
+    return signals;
+}
+
+static void set_layout(uint32_t value) {
+    const setting_detail_t* setting = NULL;
+    for (uint8_t i = 0; host_settings && i < host_settings->n_settings; i++) {
+        if (!strcmp(host_settings->settings[i].name, "Display layout")) {
+            setting = &host_settings->settings[i];
+        }
+    }
+    CHECK(setting != NULL);
+    if (setting) {
+        CHECK_EQUAL(((setting_set_int_ptr)setting->value)(setting->id, value), Status_OK);
+    }
+}
+
+// Panel memory against the front buffer, columns outside the panel unwritten
+static void check_panel(void) {
+    uint16_t different = 0, written = 0;
+    for (uint8_t page = 0; page < HOST_PANEL_PAGES; page++) {
+        for (uint16_t column = 0; column < HOST_PANEL_COLUMNS; column++) {
+            if (page < display_config.pages && column >= display_config.column_offset &&
+                column < display_config.column_offset + display_config.width) {
+                if (host_panel[page][column] != display_config.front_buffer[(page * display_config.width) + column - display_config.column_offset]) {
+                    different++;
+                }
+            } else if (host_panel[page][column] != UNWRITTEN) {
+                written++;
+            }
+        }
+    }
+    CHECK_EQUAL(different, 0);
+    CHECK_EQUAL(written, 0);
+}
+
+int main(void) {
+    static uint8_t full[1024];
+    char name[64];
+    memset(host_panel, UNWRITTEN, sizeof(host_panel));
+
+#if ETHERNET_ENABLE
+    networking.get_info = get_info;
+#endif //ETHERNET_ENABLE
+    display_init();
+    host_run_for(2000);
+#if ETHERNET_ENABLE
+    network_status_t status = { 0 };
+    status.changed.ip_aquired = 1;
+    CHECK(networking.event != NULL);
+    networking.event("eth0", status);
+#endif //ETHERNET_ENABLE
+
+    settings.status_report.pin_state = 1;
+    hal.limits.get_state = get_limits;
+    for (uint8_t i = 0; i < N_AXIS; i++) {
+        sys.position[i] = ((i * 37) - 50) * 1731;
+    }
+    host_run_for(2000);
+
+    // Every text row kept, and drawn from its pre-shifted glyphs
+    CHECK_EQUAL(host_warnings, 0);
+    CHECK(display_get_stats()->text_row_glyphs > 0);
+
+    snprintf(name, sizeof(name), "layout_%ux%u_n%u%s.bin", display_config.width, display_config.height, N_AXIS, ETHERNET_ENABLE ? "_eth" : "");
+    CHECK(host_compare_golden(name, display_config.front_buffer, display_config.buffer_size));
+    check_panel();
+    memcpy(full, display_config.front_buffer, display_config.buffer_size);
+
+    // Optional fields hidden: the IP address, icons and endstops are left blank
+    set_layout(0);
+    host_run_for(2000);
+    snprintf(name, sizeof(name), "layout_%ux%u_n%u%s_bare.bin", display_config.width, display_config.height, N_AXIS, ETHERNET_ENABLE ? "_eth" : "");
+    CHECK(host_compare_golden(name, display_config.front_buffer, display_config.buffer_size));
+    CHECK(memcmp(display_config.front_buffer, full, display_config.buffer_size) != 0);
+    check_panel();
+
+    // And come back when shown again
+    set_layout(7);
+    host_run_for(2000);
+    CHECK(!memcmp(display_config.front_buffer, full, display_config.buffer_size));
+
+    return host_failures;
+}
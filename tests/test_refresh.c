@@ -0,0 +1,76 @@
+/*
+
+  test_refresh.c - first frame sent to the panel and to the refresh listener.
+
+  The panel memory is filled with garbage as after power up, the first
+  frame must leave the panel, or the frame rebuilt by the refresh listener
+  of a virtual display, equal to the front buffer whatever the buffers held
+  when allocated.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <malloc.h>
+
+#include "host.h"
+#include "oled_display.h"
+
+#if DISPLAY_VIRTUAL
+static uint8_t listener_frame[HOST_PANEL_PAGES][HOST_PANEL_COLUMNS];
+
+static void refresh_listener(uint8_t page, uint8_t column, uint8_t length, const uint8_t* data) {
+    if (length) {
+        memcpy(&listener_frame[page][column], data, length);
+    }
+}
+#endif //DISPLAY_VIRTUAL
+
+int main(void) {
+    // Allocations are filled with zeros: the front buffer then matches the
+    // blank parts of the first frame while the panel memory does not
+    mallopt(M_PERTURB, 0xFF);
+    memset(host_panel, 0xA5, sizeof(host_panel));
+
+#if DISPLAY_VIRTUAL
+    memset(listener_frame, 0xA5, sizeof(listener_frame));
+    host_panel_present = false;
+    display_set_refresh_listener(refresh_listener);
+#endif //DISPLAY_VIRTUAL
+
+    CHECK(display_oled_init());
+    host_run_immediate();
+
+    uint16_t different = 0;
+    for (uint8_t page = 0; page < display_config.pages; page++) {
+        for (uint8_t column = 0; column < display_config.width; column++) {
+#if DISPLAY_VIRTUAL
+            uint8_t shown = listener_frame[page][column];
+#else
+            uint8_t shown = host_panel[page][column + display_config.column_offset];
+#endif //DISPLAY_VIRTUAL
+            if (shown != display_config.front_buffer[(page * display_config.width) + column] ||
+                shown != display_config.back_buffer[(page * display_config.width) + column]) {
+                different++;
+            }
+        }
+    }
+    CHECK_EQUAL(different, 0);
+
+    return host_failures;
+}
@@ -0,0 +1,221 @@
+/*
+
+  test_screenshot.c - $OLEDSHOT records decoded back to the frame.
+
+  The records written to the stream are decoded (base64, then run length)
+  into the PBM file, which is turned into a framebuffer and into a
+  page-major image file. Both the PBM pixels and the image file drawn by
+  display_draw_image_file() must match the captured buffer byte for byte.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <unistd.h>
+
+#include "host.h"
+#include "oled_display.h"
+
+#define RECORDS_SIZE 8192
+#define PBM_SIZE 2048
+
+void display_init(void);
+
+static char records[RECORDS_SIZE];
+static uint16_t records_length = 0;
+static uint16_t record_count = 0;
+static uint16_t longest_record = 0;
+
+static void stream_write(const char* s) {
+    uint16_t length = strlen(s);
+    if (records_length + length < RECORDS_SIZE) {
+        memcpy(&records[records_length], s, length + 1);
+        records_length += length;
+    }
+    record_count++;
+    if (length > longest_record) {
+        longest_record = length;
+    }
+}
+
+static uint16_t base64_decode(const char* text, uint16_t length, uint8_t* out) {
+    static const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    uint16_t size = 0;
+    uint32_t bits = 0;
+    uint8_t count = 0;
+    for (uint16_t i = 0; i < length && text[i] != '='; i++) {
+        bits = (bits << 6) | (strchr(base64, text[i]) - base64);
+        if (++count == 4) {
+            out[size++] = bits >> 16;
+            out[size++] = bits >> 8;
+            out[size++] = bits;
+            bits = count = 0;
+        }
+    }
+    if (count == 3) {
+        out[size++] = bits >> 10;
+        out[size++] = bits >> 2;
+    } else if (count == 2) {
+        out[size++] = bits >> 4;
+    }
+    return size;
+}
+
+// Same encoding as the image files: [0x80 | (count - 1)][byte] runs, [count - 1][bytes] literals
+static uint16_t rle_decode(const uint8_t* data, uint16_t length, uint8_t* out, uint16_t out_size) {
+    uint16_t size = 0;
+    for (uint16_t i = 0; i < length;) {
+        uint8_t count = (data[i] & 0x7F) + 1;
+        if (size + count > out_size) {
+            return 0;
+        }
+        if (data[i] & 0x80) {
+            memset(&out[size], data[i + 1], count);
+            i += 2;
+        } else {
+            memcpy(&out[size], &data[i + 1], count);
+            i += 1 + count;
+        }
+        size += count;
+    }
+    return size;
+}
+
+// Runs $OLEDSHOT and decodes its records into the PBM file, returns its size
+static uint16_t screenshot(char* args, uint8_t* pbm) {
+    static uint8_t compressed[PBM_SIZE];
+    const sys_command_t* command = NULL;
+    for (uint8_t i = 0; host_commands && i < host_commands->n_commands; i++) {
+        if (!strcmp(host_commands->commands[i].command, "OLEDSHOT")) {
+            command = &host_commands->commands[i];
+        }
+    }
+    CHECK(command != NULL);
+    if (command == NULL) {
+        return 0;
+    }
+
+    records_length = record_count = longest_record = 0;
+    CHECK_EQUAL(command->execute(STATE_IDLE, args), Status_OK);
+
+    // A record per foreground loop, so other stream traffic is not delayed
+    while (host_run_one_immediate()) {
+        CHECK(record_count <= 2);
+        stream_write("<Idle|MPos:0.000,0.000,0.000>\r\n");
+        record_count = 0;
+    }
+    CHECK(longest_record <= 12 + (((DISPLAY_SCREENSHOT_CHUNK + 2) / 3) * 4) + 4);
+
+    // Records, status reports interleaved
+    unsigned width = 0, height = 0, pbm_size = 0, compressed_size = 0;
+    uint16_t length = 0;
+    bool ended = false;
+    for (char* line = strtok(records, "\r\n"); line; line = strtok(NULL, "\r\n")) {
+        if (strncmp(line, "[OLEDSHOT:", 10)) {
+            continue;
+        }
+        line += 10;
+        if (sscanf(line, "BEGIN,%u,%u,%u]", &width, &height, &pbm_size) == 3) {
+            length = 0;
+        } else if (sscanf(line, "END,%u]", &compressed_size) == 1) {
+            ended = true;
+        } else {
+            length += base64_decode(line, strchr(line, ']') - line, &compressed[length]);
+        }
+    }
+    CHECK(ended);
+    CHECK_EQUAL(width, display_config.width);
+    CHECK_EQUAL(height, display_config.height);
+    CHECK_EQUAL(compressed_size, length);
+    printf("$OLEDSHOT%s%s: %u bytes PBM, %u bytes compressed\n", args ? "=" : "", args ? args : "", pbm_size, length);
+
+    uint16_t size = rle_decode(compressed, length, pbm, PBM_SIZE);
+    CHECK_EQUAL(size, pbm_size);
+    return size;
+}
+
+// Turns the PBM file into a page-major framebuffer and an image file
+static void check_pbm(const uint8_t* pbm, uint16_t size, const uint8_t* expected, const char* image_path) {
+    char header[16];
+    uint8_t header_size = snprintf(header, sizeof(header), "P4\n%u %u\n", display_config.width, display_config.height);
+    CHECK(size > header_size && !memcmp(pbm, header, header_size));
+    if (size <= header_size) {
+        return;
+    }
+
+    static uint8_t frame[1024];
+    uint8_t row_bytes = (display_config.width + 7) / 8;
+    memset(frame, 0, sizeof(frame));
+    for (uint16_t y = 0; y < display_config.height; y++) {
+        for (uint16_t x = 0; x < display_config.width; x++) {
+            if (!(pbm[header_size + (y * row_bytes) + (x / 8)] & (0x80 >> (x % 8)))) {
+                frame[((y / 8) * display_config.width) + x] |= 1 << (y % 8);
+            }
+        }
+    }
+    CHECK(!memcmp(frame, expected, display_config.buffer_size));
+
+    // Loaded back through the image file loader
+    FILE* file = fopen(image_path, "wb");
+    CHECK(file != NULL);
+    if (file) {
+        uint8_t image_header[3] = { display_config.width, display_config.height, 0 };
+        fwrite(image_header, 1, sizeof(image_header), file);
+        fwrite(frame, 1, display_config.buffer_size, file);
+        fclose(file);
+    }
+    display_clear();
+    CHECK(display_draw_image_file(0, 0, strrchr(image_path, '/')));
+    CHECK(!memcmp(display_config.back_buffer, expected, display_config.buffer_size));
+    remove(image_path);
+}
+
+int main(void) {
+    static uint8_t pbm[PBM_SIZE];
+    static uint8_t expected[1024];
+    static char root[] = "/tmp/oled_shot_XXXXXX";
+    char image_path[64];
+    CHECK(mkdtemp(root) != NULL);
+    host_vfs_root = root;
+    snprintf(image_path, sizeof(image_path), "%s/shot.bin", root);
+
+    hal.stream.write = stream_write;
+    display_init();
+    host_run_for(2000);
+
+    // Runs and literals of all lengths, pixels set and unset
+    srand(1);
+    for (uint16_t i = 0; i < display_config.buffer_size; i++) {
+        display_config.front_buffer[i] = (i / 97) % 3 ? rand() : (i / 97) % 2 ? 0xFF : 0x00;
+    }
+    memcpy(expected, display_config.front_buffer, display_config.buffer_size);
+    uint16_t size = screenshot(NULL, pbm);
+    check_pbm(pbm, size, expected, image_path);
+
+    // The buffer being drawn
+    display_clear();
+    display_draw_string(3, 20, "X: -123.456");
+    display_draw_rect(0, 0, display_config.width, display_config.height);
+    memcpy(expected, display_config.back_buffer, display_config.buffer_size);
+    size = screenshot("BACK", pbm);
+    check_pbm(pbm, size, expected, image_path);
+
+    rmdir(root);
+
+    return host_failures;
+}
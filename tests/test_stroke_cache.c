@@ -0,0 +1,65 @@
+/*
+
+  test_stroke_cache.c - stroke strings cache and canvases.
+
+  Stroke strings drawn on the display fill the cache, strings drawn inside
+  an overlay canvas must neither evict an entry nor count a miss, and the
+  cached strings must still hit afterwards.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "oled_display.h"
+
+int main(void) {
+    const display_stats_t* stats = display_get_stats();
+
+    CHECK(display_oled_init());
+    host_run_immediate();
+
+    // Both entries filled, then hit
+    display_clear();
+    display_draw_stroke_string(0, 0, "-12.345", 14);
+    display_draw_stroke_string(0, 20, "678.9", 14);
+    CHECK_EQUAL(stats->stroke_cache_misses, 2);
+    display_draw_stroke_string(0, 0, "-12.345", 14);
+    display_draw_stroke_string(0, 20, "678.9", 14);
+    CHECK_EQUAL(stats->stroke_cache_hits, 2);
+
+    // Drawn inside an overlay: the cache is not used
+    display_overlay_t* overlay = display_overlay_add(0, 40, 64, 20, 1);
+    CHECK(overlay != NULL);
+    CHECK(display_overlay_begin(overlay));
+    display_draw_stroke_string(0, 0, "42", 14);
+    display_draw_stroke_string(0, 0, "-12.345", 14);
+    display_overlay_end(overlay);
+    CHECK_EQUAL(stats->stroke_cache_misses, 2);
+    CHECK_EQUAL(stats->stroke_cache_hits, 2);
+
+    // The entries are still there
+    display_draw_stroke_string(0, 0, "-12.345", 14);
+    display_draw_stroke_string(0, 20, "678.9", 14);
+    CHECK_EQUAL(stats->stroke_cache_misses, 2);
+    CHECK_EQUAL(stats->stroke_cache_hits, 4);
+
+    display_overlay_remove(overlay);
+
+    return host_failures;
+}
@@ -0,0 +1,110 @@
+/*
+
+  test_text_rows.c - declared text rows against strings drawn from the font.
+
+  Strings in both colors, at page aligned and unaligned rows, partly above
+  the display and cut at its right edge, are drawn from the font, then
+  again once their rows are declared: the frames must be the same. The
+  glyphs of a declared row must be drawn from the row, without reading the
+  font beyond its header, and characters not declared for the row still
+  come from the font. Rows of the same font and y phase share their glyphs,
+  and a row is refused once the 3 rows of the build are used.
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "host.h"
+#include "oled_display.h"
+
+// Rows of the frame, the last one partly above the display
+static const struct {
+    display_font_size_t font;
+    int16_t x;
+    int16_t y;
+    const char* text;
+} rows[] = {
+    { DISPLAY_FONT_SMALL, 0, 0, "X: -123.456" },
+    { DISPLAY_FONT_SMALL, 0, 16, "Y:  7890.12" },
+    { DISPLAY_FONT_BIG, 20, 34, "-0.500" },
+    { DISPLAY_FONT_MEDIUM, 100, 53, "IDLE" },
+    { DISPLAY_FONT_SMALL, 90, -3, "0.1.2" },
+};
+
+#define ROWS (sizeof(rows) / sizeof(rows[0]))
+
+static void draw_frame(void) {
+    display_clear();
+    display_set_color(DISPLAY_COLOR_WHITE);
+    display_fill_rect(0, 15, 128, 12);
+    for (uint8_t i = 0; i < ROWS; i++) {
+        display_set_color(i == 1 ? DISPLAY_COLOR_BLACK : DISPLAY_COLOR_WHITE);
+        display_set_font(rows[i].font);
+        display_draw_string(rows[i].x, rows[i].y, rows[i].text);
+    }
+    display_set_color(DISPLAY_COLOR_WHITE);
+}
+
+// Flash reads of a string drawn with the small font
+static uint32_t draw_reads(int16_t y, const char* text) {
+    uint32_t reads = host_flash_reads;
+    display_draw_string_with_font(0, y, text, display_config.display_small_font);
+    return host_flash_reads - reads;
+}
+
+int main(void) {
+    static uint8_t reference[1024];
+    const display_stats_t* stats = display_get_stats();
+
+    CHECK(display_oled_init());
+
+    draw_frame();
+    memcpy(reference, display_config.back_buffer, display_config.buffer_size);
+    CHECK_EQUAL(stats->text_row_glyphs, 0);
+
+    // Same frame from the declared rows, the IDLE row without its D
+    CHECK(display_prepare_text_row(DISPLAY_FONT_SMALL, 0, "XY:-0123456789. "));
+    CHECK(display_prepare_text_row(DISPLAY_FONT_BIG, 34, "-0123456789."));
+    CHECK(display_prepare_text_row(DISPLAY_FONT_MEDIUM, 53, "IEL"));
+    CHECK(display_prepare_text_row(DISPLAY_FONT_SMALL, -3, "0123456789."));
+    draw_frame();
+    CHECK(!memcmp(display_config.back_buffer, reference, display_config.buffer_size));
+    // Y:  7890.12 shares the row at 0, the D of IDLE comes from the font
+    uint32_t glyphs = stats->text_row_glyphs;
+    CHECK_EQUAL(glyphs, 11 + 11 + 6 + 3 + 5);
+
+    // Glyphs of a declared row read no more than the font header
+    uint32_t header = draw_reads(16, "");
+    CHECK(header > 0);
+    CHECK_EQUAL(draw_reads(16, "0123"), header);
+    CHECK(draw_reads(17, "0123") > header);
+    CHECK_EQUAL(stats->text_row_glyphs - glyphs, 4);
+
+    // Characters added to a row keep the ones already declared
+    CHECK(display_prepare_text_row(DISPLAY_FONT_SMALL, 8, "AB"));
+    CHECK_EQUAL(draw_reads(24, "AB0123"), header);
+
+    // The medium font is the small one: its row at 53 is shared with the row at -3,
+    // the 3 rows are used and other phases are refused and drawn from the font
+    CHECK(!display_prepare_text_row(DISPLAY_FONT_SMALL, 7, "0"));
+    CHECK(draw_reads(23, "0") > header);
+    draw_frame();
+    CHECK(!memcmp(display_config.back_buffer, reference, display_config.buffer_size));
+
+    return host_failures;
+}
@@ -77,11 +77,17 @@ from PIL import Image, ImageDraw, ImageFont
 import os
 import math
 import datetime
+import heapq
 import freetype
 import numpy as np
 import matplotlib.pyplot as plt
 import re
 
+# Font format flags, stored in the upper bits of the char count MSB
+FONT_FLAG_CROPPED = 0x80  # Glyphs are cropped to their ink bounding box
+FONT_FLAG_COMPRESSED = 0x40  # Glyphs are Huffman compressed
+FONT_COUNT_MSB_MASK = 0x1F  # Remaining bits of the char count MSB
+
 # Spacing calculation (to be adjusted)
 def calculate_default_spacing(font_size):
     if font_size <= 10:
@@ -125,6 +131,171 @@ def get_safe_filename(char, char_code):
     else:
         return f"char_{char_code:03d}_{char}"
 
+def crop_glyph(char_bytes, bytes_per_col):
+    """
+    Crop a column-wise glyph bitmap to its ink bounding box.
+    
+    Args:
+        char_bytes: Column-wise bitmap bytes of the full height glyph
+        bytes_per_col: Number of bytes per column in char_bytes
+        
+    Returns:
+        The cropped glyph bytes, starting with the glyph header
+        [x_offset, y_offset, bytes_per_column], or an empty list if the glyph has no ink
+    """
+    # Rebuild each column as an integer, bit 0 being the top pixel
+    columns = []
+    for x in range(len(char_bytes) // bytes_per_col):
+        value = 0
+        for byte_idx in range(bytes_per_col):
+            value |= char_bytes[x * bytes_per_col + byte_idx] << (byte_idx * 8)
+        columns.append(value)
+    
+    inked = [x for x, value in enumerate(columns) if value]
+    if not inked:
+        return []
+    
+    # Horizontal and vertical bounding box
+    first_col, last_col = inked[0], inked[-1]
+    all_bits = 0
+    for value in columns:
+        all_bits |= value
+    y_offset = (all_bits & -all_bits).bit_length() - 1
+    ink_height = all_bits.bit_length() - y_offset
+    cropped_bytes_per_col = (ink_height + 7) // 8
+    
+    cropped = [first_col, y_offset, cropped_bytes_per_col]
+    for value in columns[first_col:last_col + 1]:
+        value >>= y_offset
+        for byte_idx in range(cropped_bytes_per_col):
+            cropped.append((value >> (byte_idx * 8)) & 0xFF)
+    
+    return cropped
+
+def build_huffman_lengths(frequencies):
+    """
+    Compute Huffman code lengths for each symbol.
+    
+    Args:
+        frequencies: Dictionary of symbol -> number of occurrences
+        
+    Returns:
+        Dictionary of symbol -> code length in bits
+    """
+    if len(frequencies) == 1:
+        return {symbol: 1 for symbol in frequencies}
+    
+    # Each node is (frequency, tie breaker, symbols under this node)
+    nodes = [(count, symbol, [symbol]) for symbol, count in frequencies.items()]
+    heapq.heapify(nodes)
+    lengths = {symbol: 0 for symbol in frequencies}
+    tie_breaker = 256
+    while len(nodes) > 1:
+        count1, _, symbols1 = heapq.heappop(nodes)
+        count2, _, symbols2 = heapq.heappop(nodes)
+        for symbol in symbols1 + symbols2:
+            lengths[symbol] += 1
+        heapq.heappush(nodes, (count1 + count2, tie_breaker, symbols1 + symbols2))
+        tie_breaker += 1
+    
+    return lengths
+
+def compress_glyphs(glyph_data, jump_table_entries, cropped):
+    """
+    Compress glyph bitmaps with a static canonical Huffman code shared by the whole font.
+    
+    Args:
+        glyph_data: Concatenated bitmap data of all glyphs
+        jump_table_entries: List of (msb, lsb, size, width) entries pointing into glyph_data
+        cropped: True if glyphs start with the 3 bytes cropped glyph header
+        
+    Returns:
+        A tuple (huffman_table, compressed_data, jump_table_entries, stats), or None if
+        the code can't be represented (code longer than 15 bits)
+    """
+    header_size = 3 if cropped else 0
+    
+    # Split glyphs, keeping the cropped glyph header apart
+    glyphs = []
+    for msb, lsb, size, width in jump_table_entries:
+        if (msb == 0xFF and lsb == 0xFF) or size <= header_size:
+            glyphs.append(None)
+            continue
+        offset = (msb << 8) | lsb
+        glyphs.append((glyph_data[offset:offset + header_size], glyph_data[offset + header_size:offset + size]))
+    
+    # Build the canonical code
+    frequencies = {}
+    for glyph in glyphs:
+        if glyph:
+            for byte in glyph[1]:
+                frequencies[byte] = frequencies.get(byte, 0) + 1
+    if not frequencies:
+        return None
+    lengths = build_huffman_lengths(frequencies)
+    max_length = max(lengths.values())
+    if max_length > 15:
+        print(f"Warning: Huffman code too long ({max_length} bits), font is not compressed")
+        return None
+    
+    symbols = sorted(frequencies, key=lambda symbol: (lengths[symbol], symbol))
+    codes = {}
+    code = 0
+    previous_length = lengths[symbols[0]]
+    for symbol in symbols:
+        code <<= lengths[symbol] - previous_length
+        previous_length = lengths[symbol]
+        codes[symbol] = code
+        code += 1
+    
+    # Table: max length, count of codes for each length, symbols
+    huffman_table = [max_length]
+    for length in range(1, max_length + 1):
+        huffman_table.append(sum(1 for symbol in symbols if lengths[symbol] == length))
+    huffman_table.extend(symbols)
+    
+    # Encode each glyph: [cropped header] [decoded size] [bitstream, MSB first]
+    compressed_data = []
+    new_entries = []
+    decoded_bits = 0
+    decoded_bytes = 0
+    for glyph, (msb, lsb, size, width) in zip(glyphs, jump_table_entries):
+        if glyph is None:
+            new_entries.append((msb, lsb, 0, width) if (msb == 0xFF and lsb == 0xFF) else (0, 0, 0, width))
+            continue
+        header, body = glyph
+        bits = "".join(format(codes[byte], f"0{lengths[byte]}b") for byte in body)
+        bits += "0" * (-len(bits) % 8)
+        encoded = list(header) + [len(body)] + [int(bits[i:i + 8], 2) for i in range(0, len(bits), 8)]
+        offset = len(compressed_data)
+        new_entries.append(((offset >> 8) & 0xFF, offset & 0xFF, len(encoded), width))
+        compressed_data.extend(encoded)
+        decoded_bits += sum(lengths[byte] for byte in body)
+        decoded_bytes += len(body)
+    
+    stats = {
+        'raw_size': len(glyph_data),
+        'compressed_size': len(compressed_data) + len(huffman_table),
+        'table_size': len(huffman_table),
+        'max_length': max_length,
+        'bits_per_byte': decoded_bits / decoded_bytes if decoded_bytes else 0
+    }
+    
+    return huffman_table, compressed_data, new_entries, stats
+
+def print_compression_stats(stats):
+    """
+    Print flash saving and decode cost of compressed glyphs side by side.
+    """
+    saving = stats['raw_size'] - stats['compressed_size']
+    print("\nGlyph Compression Summary:")
+    print("==========================")
+    print(f"{'':24}{'Raw':>10}{'Compressed':>12}")
+    print(f"{'Glyph data (bytes)':24}{stats['raw_size']:>10}{stats['compressed_size']:>12}  (Huffman table: {stats['table_size']} bytes)")
+    print(f"{'Flash saving (bytes)':24}{'':>10}{saving:>12}  ({100.0 * saving / stats['raw_size']:.1f}%)")
+    print(f"{'Bit reads per byte':24}{'0':>10}{stats['bits_per_byte']:>12.2f}  (max code length: {stats['max_length']} bits)")
+    print(f"{'Flash reads per byte':24}{'1':>10}{stats['bits_per_byte'] * 9 / 8 + 2:>12.2f}")
+
 def save_debug_images(char, char_bitmap, final_bitmap_bytes, debug_dir, max_height, bytes_per_col):
     """
     Save debug images showing bitmap representations of a character.
@@ -198,7 +369,7 @@ def parse_scope_string(scope_str):
             
     return [ord(c) for c in unique_chars]
 
-def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32, 128), variable_name=None, debug=False, spacing=None):
+def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32, 128), variable_name=None, debug=False, spacing=None, crop=False, compress=False):
     """
     Generate font data from a TrueType font file using FreeType for accurate metrics.
     
@@ -209,6 +380,8 @@ def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32,
         char_range: Range of characters to include (start, end) if custom_scope is None
         variable_name: Name of the variable in the output file
         debug: If True, save debug images of each character
+        crop: If True, crop each glyph to its ink bounding box
+        compress: If True, Huffman compress the glyph bitmaps
         
     Returns:
         A tuple containing the font data and font info
@@ -303,6 +476,7 @@ def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32,
     chars_data = []
     jump_table_entries = []
     offset = 0
+    uncropped_size = 0
     
     # Get space character advance width
     space_width = max_width // 3  # Default fallback
@@ -422,6 +596,11 @@ def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32,
             width = advance_width if advance_width > 0 else bitmap_width
             char_widths[char] = width
             
+            # Keep only the inked bytes if requested
+            uncropped_size += len(char_bytes)
+            if crop:
+                char_bytes = crop_glyph(char_bytes, bytes_per_col)
+            
             # Log width information
             if debug:
                 with open(width_log_path, 'a') as wf:
@@ -463,9 +642,9 @@ def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32,
     font_data = []
     
     # Check if the number of characters exceeds 16-bit limit
-    if len(char_codes) > 65535:
-        print(f"Warning: Number of characters ({len(char_codes)}) exceeds 65535, truncating to 65535")
-        char_codes = char_codes[:65535]
+    if len(char_codes) > 8191:
+        print(f"Warning: Number of characters ({len(char_codes)}) exceeds 8191, truncating to 8191")
+        char_codes = char_codes[:8191]
     if spacing is not None:
         font_spacing  = spacing
     else:
@@ -473,10 +652,25 @@ def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32,
     
     print(f"Using character spacing: {font_spacing } pixels")
     
+    flags = FONT_FLAG_CROPPED if crop else 0
+    if crop:
+        # Each cropped glyph carries a 3 bytes header, so cropping does not always pay off
+        print(f"Glyph data: {offset} bytes cropped, {uncropped_size} bytes uncropped")
+    
+    # Compress glyphs if requested
+    huffman_table = []
+    if compress:
+        result = compress_glyphs([byte for char_bytes in chars_data for byte in char_bytes], jump_table_entries, crop)
+        if result:
+            huffman_table, compressed_data, jump_table_entries, stats = result
+            chars_data = [compressed_data]
+            flags |= FONT_FLAG_COMPRESSED
+            print_compression_stats(stats)
+    
     # Header: width, height, char count MSB, char count LSB
     font_data.append(max_width)
     font_data.append(max_height)
-    font_data.append((len(char_codes) >> 8) & 0xFF)  # MSB of char count
+    font_data.append(((len(char_codes) >> 8) & FONT_COUNT_MSB_MASK) | flags)  # Format flags and MSB of char count
     font_data.append(len(char_codes) & 0xFF)         # LSB of char count
     font_data.append(font_spacing  & 0xFF)                 # spacing
     
@@ -488,6 +682,9 @@ def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32,
     for entry in jump_table_entries:
         font_data.extend(entry)
     
+    # Huffman table - only for compressed fonts
+    font_data.extend(huffman_table)
+    
     # Character data
     for char_bytes in chars_data:
         font_data.extend(char_bytes)
@@ -506,6 +703,7 @@ def generate_font_data(font_path, font_size, custom_scope=None, char_range=(32,
         'descender': descender,
         'char_widths': char_widths,  # Store character widths for reference
         'bytes_per_col': bytes_per_col,  # Store bytes per column for reference
+        'flags': flags,
         'char_codes': char_codes  # Store the actual character codes
     }
     
@@ -568,6 +766,18 @@ def create_debug_summary(font_path, font_size, char_codes, debug_dir, char_width
     plt.savefig(summary_path, dpi=150)
     print(f"Saved character summary to {summary_path}")
 
+def write_binary_font(font_data, output_path):
+    """
+    Write the font data as a binary file, to be loaded at runtime from the
+    controller file system (SD card or littlefs) with display_load_font().
+    
+    Args:
+        font_data: The font data array
+        output_path: Path to save the binary file
+    """
+    with open(output_path, 'wb') as f:
+        f.write(bytes(font_data))
+
 def generate_c_header(font_data, font_info, output_path):
     """
     Generate a C header file with the font data.
@@ -592,18 +802,28 @@ def generate_c_header(font_data, font_info, output_path):
         f.write(f" * Bytes per Column: {font_info['bytes_per_col']}\n")
         f.write(f" *\n")
         f.write(f" * Font Data Format:\n")
-        f.write(f" * - First 5 bytes: max width, height, char count MSB, char count LSB, spacing\n")
+        f.write(f" * - First 5 bytes: max width, height, flags | char count MSB, char count LSB, spacing\n")
+        f.write(f" *   - flags 0x80: glyphs are cropped to their ink bounding box\n")
+        f.write(f" *   - flags 0x40: glyphs are Huffman compressed\n")
         f.write(f" * - Character Table: N bytes listing the codes of included characters\n")
         f.write(f" * - Jump Table: 4 bytes per character\n")
         f.write(f" *   - byte 0-1: MSB & LSB of offset in data array\n")
         f.write(f" *   - byte 2: Size in bytes of this character's bitmap\n")
         f.write(f" *   - byte 3: Width of character in pixels\n")
         f.write(f" * - Font Data: Bitmap data for all characters\n")
+        if font_info.get('flags', 0) & FONT_FLAG_CROPPED:
+            f.write(f" *   - each glyph starts with 3 bytes: x offset, y offset, bytes per column\n")
+            f.write(f" *     followed by the inked columns only\n")
+        if font_info.get('flags', 0) & FONT_FLAG_COMPRESSED:
+            f.write(f" * - Huffman Table (between jump table and font data): max code length L,\n")
+            f.write(f" *   L bytes giving the count of codes of each length, then the symbols\n")
+            f.write(f" *   - each glyph gives its decoded size in bytes, then its canonical\n")
+            f.write(f" *     Huffman bitstream, most significant bit first\n")
         f.write(f" *\n")
         f.write(f" * To render character 'X':\n")
         f.write(f" * 1. Get font info from header:\n")
         f.write(f" *    - Get max width, height from bytes 0-1\n")
-        f.write(f" *    - Get character count from (byte 2 << 8) | byte 3\n")
+        f.write(f" *    - Get character count from ((byte 2 & 0x1F) << 8) | byte 3\n")
         f.write(f" *    - Get recommended spacing from byte 4\n")
         f.write(f" * 2. Search for character code of 'X' in the character table\n")
         f.write(f" *    (bytes 5 to 5+N-1)\n")
@@ -613,8 +833,12 @@ def generate_c_header(font_data, font_info, output_path):
         f.write(f" *    - offset = (jump_table[0] << 8) | jump_table[1]\n")
         f.write(f" *    - size = jump_table[2]\n")
         f.write(f" *    - width = jump_table[3]\n")
-        f.write(f" * 5. Bytes per column: {font_info['bytes_per_col']}\n")
-        f.write(f" * 6. Render bitmap columns from the data section\n")
+        if font_info.get('flags', 0) & FONT_FLAG_CROPPED:
+            f.write(f" * 5. Read the glyph header, bytes per column is given per glyph\n")
+            f.write(f" * 6. Render bitmap columns from the data section at (x + x offset, y + y offset)\n")
+        else:
+            f.write(f" * 5. Bytes per column: {font_info['bytes_per_col']}\n")
+            f.write(f" * 6. Render bitmap columns from the data section\n")
         f.write(f" * 7. Advance cursor position by: character_width + font_spacing\n")
         f.write(f" *\n")
         f.write(f" * This file was automatically generated by font_converter on {current_date}\n")
@@ -636,9 +860,15 @@ def generate_c_header(font_data, font_info, output_path):
         f.write(f"\t0x{font_info['height']:02X}, // Height: {font_info['height']}\n")
         
         # Number of characters (16 bits)
-        char_count_msb = (font_info['char_count'] >> 8) & 0xFF
+        char_count_msb = ((font_info['char_count'] >> 8) & FONT_COUNT_MSB_MASK) | font_info.get('flags', 0)
         char_count_lsb = font_info['char_count'] & 0xFF
-        f.write(f"\t0x{char_count_msb:02X}, // Number of Chars MSB\n")
+        flags_names = []
+        if font_info.get('flags', 0) & FONT_FLAG_CROPPED:
+            flags_names.append("cropped")
+        if font_info.get('flags', 0) & FONT_FLAG_COMPRESSED:
+            flags_names.append("compressed")
+        flags_comment = f" ({', '.join(flags_names)} glyphs)" if flags_names else ""
+        f.write(f"\t0x{char_count_msb:02X}, // Number of Chars MSB{flags_comment}\n")
         f.write(f"\t0x{char_count_lsb:02X}, // Number of Chars LSB: {font_info['char_count']}\n\n")
         spacing_value = font_info.get('spacing', 1)  # Valeur par défaut 1 si non définie
         f.write(f"\t0x{spacing_value:02X}, // Character Spacing: {spacing_value} pixels\n\n")
@@ -688,10 +918,20 @@ def generate_c_header(font_data, font_info, output_path):
                 
                 f.write(f"\t0x{msb:02X}, 0x{lsb:02X}, 0x{size:02X}, 0x{width:02X},  // {comment}\n")
         
-        f.write("\n\t// Font Data:\n")
-        
         # Font data section (after the header, character table, and jump table)
         data_start = jump_table_start + (font_info['char_count'] * 4)  # Skip header, char table, and jump table
+        
+        # Huffman table section (compressed fonts only)
+        if font_info.get('flags', 0) & FONT_FLAG_COMPRESSED:
+            max_length = font_data[data_start]
+            table_size = 1 + max_length + sum(font_data[data_start + 1:data_start + 1 + max_length])
+            f.write("\n\t// Huffman Table: max code length, codes count per length, symbols\n")
+            for i in range(data_start, data_start + table_size, 10):
+                line = ", ".join(f"0x{byte:02X}" for byte in font_data[i:min(i + 10, data_start + table_size)])
+                f.write(f"\t{line},\n")
+            data_start += table_size
+        
+        f.write("\n\t// Font Data:\n")
         line_length = 0
         f.write("\t")
         
@@ -716,12 +956,15 @@ def main():
     parser = argparse.ArgumentParser(description='Convert TrueType fonts to OLED display compatible format')
     parser.add_argument('font_path', help='Path to the TrueType font file')
     parser.add_argument('font_size', type=int, help='Font size in pixels')
-    parser.add_argument('--output', '-o', help='Output header file path')
+    parser.add_argument('--output', '-o', help='Output header or binary file path')
     parser.add_argument('--name', help='Variable name for the font in the output file')
     parser.add_argument('--range', help='Character range in format "start-end" (e.g., "32-128")', default="32-128")
     parser.add_argument('--scope', help='Custom character set (e.g., "ABC123")')
     parser.add_argument('--debug', action='store_true', help='Save debug bitmap images for characters')
     parser.add_argument('--spacing', type=int, help='Override character spacing in pixels (default: calculated based on font size)')
+    parser.add_argument('--crop', action='store_true', help='Crop each glyph to its ink bounding box to reduce font size')
+    parser.add_argument('--compress', action='store_true', help='Huffman compress glyph bitmaps to reduce font size')
+    parser.add_argument('--binary', action='store_true', help='Write a binary font file to load from the controller file system')
     
     args = parser.parse_args()
     spacing=args.spacing
@@ -744,7 +987,7 @@ def main():
     # Generate output path if not specified
     if args.output is None:
         font_basename = os.path.splitext(os.path.basename(args.font_path))[0]
-        args.output = f"{font_basename}_{args.font_size}.h"
+        args.output = f"{font_basename}_{args.font_size}.{'bin' if args.binary else 'h'}"
     
     # Generate font data
     font_data, font_info = generate_font_data(
@@ -753,14 +996,20 @@ def main():
         custom_scope=custom_scope,
         char_range=char_range,
         variable_name=args.name,
-        debug=args.debug
+        debug=args.debug,
+        spacing=spacing,
+        crop=args.crop,
+        compress=args.compress
     )
     
     if font_data is None:
         return
     
-    # Generate C header file
-    generate_c_header(font_data, font_info, args.output)
+    # Generate C header file or binary font file
+    if args.binary:
+        write_binary_font(font_data, args.output)
+    else:
+        generate_c_header(font_data, font_info, args.output)
     
     print(f"Font conversion complete! Output saved to {args.output}")
     print(f"Font info: {font_info['width']}x{font_info['height']} pixels, {font_info['data_size']} bytes")
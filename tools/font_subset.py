@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+"""
+Font Subset Generator for OLED Displays
+Creates a font header containing only the characters a layout can produce.
+
+The input is any font header generated by font_converter.py or font_generator.py
+(plain, cropped or compressed glyphs). Glyph bitmaps are copied unchanged, so the
+output renders exactly like the input for the kept characters.
+
+By default the output uses the direct index format (flag 0x20): the character table
+is replaced by a lookup table indexed by character code, so finding a glyph is O(1)
+instead of a linear search:
+   - Byte 0: first character code F
+   - Byte 1: last character code L
+   - L - F + 1 bytes: index of the character in the jump table, 0xFF if not in font
+
+Usage:
+  python font_subset.py input.h output.h --name oled_9 --classes digits,float --strings "X:Y:Z:"
+  python font_subset.py input.h output.h --usage dro_usage.json --font oled_9
+  python font_subset.py input.h oled_9.bin --usage dro_usage.json --font oled_9 --binary
+
+Copyright (C) 2025 Luc LEBOSSE
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+"""
+
+import argparse
+import datetime
+import json
+import os
+import re
+import sys
+
+# Font format flags, stored in the upper bits of the char count MSB
+FONT_FLAG_CROPPED = 0x80  # Glyphs are cropped to their ink bounding box
+FONT_FLAG_COMPRESSED = 0x40  # Glyphs are Huffman compressed
+FONT_FLAG_DIRECT_INDEX = 0x20  # Character table is a direct lookup table
+FONT_COUNT_MSB_MASK = 0x1F  # Remaining bits of the char count MSB
+
+# Character classes usable in --classes and in usage files
+CHARACTER_CLASSES = {
+    'space': " ",
+    'digits': "0123456789",
+    'float': "0123456789-.",
+    'ip': "0123456789.",
+    'axis': "XYZABCUVW",
+    'upper': "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+    'lower': "abcdefghijklmnopqrstuvwxyz",
+    'punctuation': "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~",
+}
+
+def parse_font_header(path):
+    """
+    Read the font array bytes from a generated font header.
+
+    Args:
+        path: Path to the font header file
+
+    Returns:
+        The variable name and the list of bytes of the font array
+    """
+    with open(path, 'r') as f:
+        text = f.read()
+
+    match = re.search(r"const\s+char\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    if not match:
+        raise ValueError(f"No font array found in {path}")
+
+    # Remove comments, they contain character representations
+    body = re.sub(r"//[^\n]*", "", match.group(2))
+    return match.group(1), [int(value, 16) for value in re.findall(r"0x([0-9A-Fa-f]{1,2})", body)]
+
+def decode_font(font_data):
+    """
+    Split a font array in its sections.
+
+    Returns:
+        A dictionary with header values, glyphs by character code and the Huffman table
+    """
+    flags = font_data[2] & ~FONT_COUNT_MSB_MASK
+    char_count = ((font_data[2] & FONT_COUNT_MSB_MASK) << 8) | font_data[3]
+
+    # Character codes in jump table order
+    if flags & FONT_FLAG_DIRECT_INDEX:
+        first_code, last_code = font_data[5], font_data[6]
+        index_table = font_data[7:7 + last_code - first_code + 1]
+        char_codes = [0] * char_count
+        for position, index in enumerate(index_table):
+            if index != 0xFF:
+                char_codes[index] = first_code + position
+        jump_table_offset = 7 + len(index_table)
+    else:
+        char_codes = font_data[5:5 + char_count]
+        jump_table_offset = 5 + char_count
+
+    data_offset = jump_table_offset + char_count * 4
+    huffman_table = []
+    if flags & FONT_FLAG_COMPRESSED:
+        max_length = font_data[data_offset]
+        table_size = 1 + max_length + sum(font_data[data_offset + 1:data_offset + 1 + max_length])
+        huffman_table = font_data[data_offset:data_offset + table_size]
+        data_offset += table_size
+
+    glyphs = {}
+    for i, char_code in enumerate(char_codes):
+        msb, lsb, size, width = font_data[jump_table_offset + i * 4:jump_table_offset + i * 4 + 4]
+        if msb == 0xFF and lsb == 0xFF:
+            glyphs[char_code] = (None, width)
+        else:
+            offset = data_offset + ((msb << 8) | lsb)
+            glyphs[char_code] = (font_data[offset:offset + size], width)
+
+    return {
+        'width': font_data[0],
+        'height': font_data[1],
+        'spacing': font_data[4],
+        'flags': flags & ~FONT_FLAG_DIRECT_INDEX,
+        'char_codes': char_codes,
+        'glyphs': glyphs,
+        'huffman_table': huffman_table,
+    }
+
+def build_scope(strings, classes):
+    """
+    Build the sorted list of character codes from strings and class names.
+    """
+    chars = set()
+    for string in strings:
+        chars.update(string)
+    for class_name in classes:
+        if class_name not in CHARACTER_CLASSES:
+            raise ValueError(f"Unknown character class '{class_name}', use one of: {', '.join(CHARACTER_CLASSES)}")
+        chars.update(CHARACTER_CLASSES[class_name])
+    return sorted(ord(char) for char in chars)
+
+def encode_subset(font, scope, direct_index=True):
+    """
+    Build the font array keeping only the characters in scope.
+
+    Returns:
+        The font array and the list of kept character codes
+    """
+    missing = [code for code in scope if code not in font['glyphs']]
+    for code in missing:
+        print(f"Warning: character '{chr(code)}' (code {code}) is not in the source font, skipped")
+    kept = [code for code in scope if code in font['glyphs']]
+    if not kept:
+        raise ValueError("No character of the scope is in the source font")
+    if direct_index and (len(kept) > 255 or kept[-1] > 255):
+        print("Warning: direct index needs at most 255 characters with codes below 256, using a character table")
+        direct_index = False
+
+    flags = font['flags'] | (FONT_FLAG_DIRECT_INDEX if direct_index else 0)
+    font_data = [font['width'], font['height'], ((len(kept) >> 8) & FONT_COUNT_MSB_MASK) | flags, len(kept) & 0xFF, font['spacing']]
+
+    # Character table or direct index table
+    if direct_index:
+        index_table = [0xFF] * (kept[-1] - kept[0] + 1)
+        for index, code in enumerate(kept):
+            index_table[code - kept[0]] = index
+        font_data += [kept[0], kept[-1]] + index_table
+    else:
+        font_data += kept
+
+    # Jump table and glyph data, glyph bytes are kept as is
+    glyph_data = []
+    for code in kept:
+        bitmap, width = font['glyphs'][code]
+        if bitmap is None:
+            font_data += [0xFF, 0xFF, 0, width]
+        else:
+            font_data += [(len(glyph_data) >> 8) & 0xFF, len(glyph_data) & 0xFF, len(bitmap), width]
+            glyph_data += bitmap
+
+    font_data += font['huffman_table']
+    font_data += glyph_data
+
+    return font_data, kept, direct_index
+
+def char_comment(code):
+    """Safe representation of a character for C comments"""
+    if code == 92:
+        return "backslash"
+    if 32 <= code <= 126:
+        return f"'{chr(code)}'"
+    return f"0x{code:02X}"
+
+def write_binary_font(font_data, output_path):
+    """
+    Write the font data as a binary file, to be loaded at runtime from the
+    controller file system (SD card or littlefs) with display_load_font().
+    
+    Args:
+        font_data: The font data array
+        output_path: Path to save the binary file
+    """
+    with open(output_path, 'wb') as f:
+        f.write(bytes(font_data))
+
+def generate_c_header(font_data, name, kept, direct_index, source, output_path):
+    """
+    Write the subset font header.
+    """
+    flags = font_data[2] & ~FONT_COUNT_MSB_MASK
+    chars = "".join(chr(code) for code in kept)
+    current_date = datetime.datetime.now().strftime("%Y-%m-%d")
+    guard_name = f"{name.upper()}_H"
+
+    with open(output_path, 'w') as f:
+        f.write(f"/*\n")
+        f.write(f" * Font Name: {name} (subset of {os.path.basename(source)})\n")
+        f.write(f" * Font Width: {font_data[0]} (maximum width of any character)\n")
+        f.write(f" * Font Height: {font_data[1]}\n")
+        f.write(f" * Character Set: Subset ({len(kept)} characters): {chars.replace('*/', '* /')}\n")
+        f.write(f" * Character Spacing: {font_data[4]} pixels\n")
+        f.write(f" * Data Size: {len(font_data)} bytes\n")
+        f.write(f" *\n")
+        f.write(f" * Font Data Format: see font_converter.py\n")
+        f.write(f" * - First 5 bytes: max width, height, flags | char count MSB, char count LSB, spacing\n")
+        if direct_index:
+            f.write(f" * - Direct Index (flag 0x20): first code F, last code L, then L - F + 1 bytes\n")
+            f.write(f" *   giving the jump table index of each code, 0xFF if not in font\n")
+        else:
+            f.write(f" * - Character Table: N bytes listing the codes of included characters\n")
+        f.write(f" * - Jump Table: 4 bytes per character [MSB, LSB, size, width]\n")
+        if flags & FONT_FLAG_COMPRESSED:
+            f.write(f" * - Huffman Table (flag 0x40)\n")
+        f.write(f" * - Font Data: Bitmap data for all characters{' (cropped, flag 0x80)' if flags & FONT_FLAG_CROPPED else ''}\n")
+        f.write(f" *\n")
+        f.write(f" * This file was automatically generated by font_subset on {current_date}\n")
+        f.write(f" * Created by Luc LEBOSSE\n")
+        f.write(f" *\n")
+        f.write(f" * This font data is licensed under the GNU LGPL v3 License.\n")
+        f.write(f" */\n\n")
+        f.write(f"#ifndef {guard_name}\n")
+        f.write(f"#define {guard_name}\n\n")
+        f.write(f"const char {name}[] PROGMEM = {{\n")
+
+        # Header
+        f.write(f"\t0x{font_data[0]:02X}, // Width: {font_data[0]} (maximum)\n")
+        f.write(f"\t0x{font_data[1]:02X}, // Height: {font_data[1]}\n")
+        f.write(f"\t0x{font_data[2]:02X}, // Flags | Number of Chars MSB\n")
+        f.write(f"\t0x{font_data[3]:02X}, // Number of Chars LSB: {len(kept)}\n")
+        f.write(f"\t0x{font_data[4]:02X}, // Character Spacing: {font_data[4]} pixels\n\n")
+
+        # Character table or direct index
+        position = 5
+        if direct_index:
+            span = kept[-1] - kept[0] + 1
+            f.write(f"\t// Direct Index: first code, last code, then index of each code\n")
+            f.write(f"\t0x{kept[0]:02X}, 0x{kept[-1]:02X}, // {char_comment(kept[0])} to {char_comment(kept[-1])}\n")
+            position += 2
+            for i in range(span):
+                index = font_data[position + i]
+                comment = f"{char_comment(kept[0] + i)}" + ("" if index != 0xFF else " (not in font)")
+                f.write(f"\t0x{index:02X}, // {comment}\n")
+            position += span
+        else:
+            f.write("\t// Character Table: List of character codes in this font\n")
+            for i, code in enumerate(kept):
+                f.write(f"\t0x{code:02X}, // {i}: {char_comment(code)}\n")
+            position += len(kept)
+        f.write("\n")
+
+        # Jump table
+        f.write("\t// Jump Table: Format is [MSB, LSB, size, width]\n")
+        for i, code in enumerate(kept):
+            msb, lsb, size, width = font_data[position:position + 4]
+            f.write(f"\t0x{msb:02X}, 0x{lsb:02X}, 0x{size:02X}, 0x{width:02X},  // {code}:{(msb << 8) + lsb} {char_comment(code)} width:{width}px\n")
+            position += 4
+
+        # Remaining data (Huffman table if any, then glyphs)
+        f.write("\n\t// Font Data:\n")
+        for i in range(position, len(font_data), 10):
+            line = ", ".join(f"0x{byte:02X}" for byte in font_data[i:i + 10])
+            f.write(f"\t{line}{',' if i + 10 < len(font_data) else ''}\n")
+        f.write("};\n\n")
+        f.write(f"#endif // {guard_name}\n")
+
+def main():
+    parser = argparse.ArgumentParser(description='Create a font header with only the characters used by a layout')
+    parser.add_argument('input', help='Source font header file')
+    parser.add_argument('output', help='Output header or binary file path')
+    parser.add_argument('--name', help='Variable name for the font (default: same as source font)')
+    parser.add_argument('--strings', action='append', default=[], help='String the layout can produce (can be repeated)')
+    parser.add_argument('--classes', help=f"Comma separated character classes: {', '.join(CHARACTER_CLASSES)}")
+    parser.add_argument('--usage', help='JSON usage file giving strings and classes for each font')
+    parser.add_argument('--font', help='Entry of the usage file to use (default: source font name)')
+    parser.add_argument('--char-table', action='store_true', help='Keep a searched character table instead of the direct index')
+    parser.add_argument('--binary', action='store_true', help='Write a binary font file to load from the controller file system')
+
+    args = parser.parse_args()
+
+    source_name, source_data = parse_font_header(args.input)
+    name = args.name if args.name else source_name
+
+    strings = list(args.strings)
+    classes = args.classes.split(',') if args.classes else []
+    if args.usage:
+        with open(args.usage, 'r') as f:
+            usage = json.load(f)
+        entry = usage.get(args.font if args.font else source_name)
+        if entry is None:
+            print(f"Error: no entry for '{args.font if args.font else source_name}' in {args.usage}")
+            sys.exit(1)
+        strings += entry.get('strings', [])
+        classes += entry.get('classes', [])
+
+    try:
+        scope = build_scope(strings, classes)
+        font = decode_font(source_data)
+        font_data, kept, direct_index = encode_subset(font, scope, not args.char_table)
+    except ValueError as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    if args.binary:
+        write_binary_font(font_data, args.output)
+    else:
+        generate_c_header(font_data, name, kept, direct_index, args.input, args.output)
+
+    print(f"Font subset complete! Output saved to {args.output}")
+    print(f"Characters: {len(font['char_codes'])} -> {len(kept)}")
+    print(f"Data size: {len(source_data)} -> {len(font_data)} bytes")
+    print(f"Lookup: {'direct index (O(1))' if direct_index else 'character table (linear search)'}")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""
+Icon Sheet Converter for OLED Displays
+Packs small icons in a page-aligned sprite sheet C header compatible with the OLED display plugin.
+
+Each icon is a PNG file (black pixels are lit, like png_converter.py) or a text template
+(one line per row, 'X' for a lit pixel, anything else is off). The icon name is the file name.
+
+Icons are stored in the display memory layout (page-major, bit 0 is the top row of a page),
+so an icon drawn at a page aligned y is a single byte copy per column.
+
+Sheet format:
+   - Byte 0: icon count N
+   - N index entries of 4 bytes: [offset MSB][offset LSB][width][pages]
+     offset is relative to the start of the icons data (after the index)
+   - Icons data: for each icon, for each page, width bytes
+
+Usage:
+  python icon_converter.py icons/*.txt -o ../images/icons.h
+  python icon_converter.py wifi.png sd.png --name status_icons -o status_icons.h
+
+Copyright (C) 2025 Luc LEBOSSE
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+"""
+
+import argparse
+import os
+import sys
+
+ICON_INDEX_ENTRY_SIZE = 4
+
+def read_template(filepath):
+    """
+    Read a text template icon
+    Returns (width, height, pixels) with pixels[y][x] True if lit
+    """
+    with open(filepath, 'r') as f:
+        rows = [line.rstrip('\n') for line in f]
+    # Ignore trailing empty lines
+    while rows and not rows[-1].strip():
+        rows.pop()
+    if not rows:
+        raise ValueError(f"{filepath} is empty")
+    width = max(len(row) for row in rows)
+    pixels = [[x < len(row) and row[x] == 'X' for x in range(width)] for row in rows]
+    return width, len(rows), pixels
+
+def read_png(filepath):
+    """
+    Read a PNG icon, black pixels are lit
+    Returns (width, height, pixels) with pixels[y][x] True if lit
+    """
+    from PIL import Image
+    img = Image.open(filepath).convert('1')
+    width, height = img.size
+    pixels = [[not img.getpixel((x, y)) for x in range(width)] for y in range(height)]
+    return width, height, pixels
+
+def icon_to_pages(width, height, pixels):
+    """
+    Convert icon pixels to page-major bytes: for each page, one byte per column, bit 0 on top
+    """
+    pages = (height + 7) // 8
+    data = []
+    for page in range(pages):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and pixels[y][x]:
+                    byte |= (1 << bit)
+            data.append(byte)
+    return data, pages
+
+def icon_name(filepath):
+    """Get the C identifier of an icon from its file name"""
+    name = os.path.splitext(os.path.basename(filepath))[0]
+    return ''.join(c if c.isalnum() else '_' for c in name).upper()
+
+def build_sheet(icon_files):
+    """
+    Build the sprite sheet
+    Returns (sheet bytes, list of (name, width, height, size))
+    """
+    if len(icon_files) > 255:
+        raise ValueError("sheet is limited to 255 icons")
+
+    index = []
+    data = []
+    icons = []
+    for filepath in icon_files:
+        if filepath.lower().endswith('.png'):
+            width, height, pixels = read_png(filepath)
+        else:
+            width, height, pixels = read_template(filepath)
+        if width > 255 or height > 255:
+            raise ValueError(f"{filepath} is bigger than 255x255 pixels")
+        icon_data, pages = icon_to_pages(width, height, pixels)
+        offset = len(data)
+        if offset > 0xFFFF:
+            raise ValueError("sheet data is limited to 64KB")
+        index += [(offset >> 8) & 0xFF, offset & 0xFF, width, pages]
+        data += icon_data
+        icons.append((icon_name(filepath), width, height, len(icon_data)))
+
+    return [len(icon_files)] + index + data, icons
+
+def generate_c_header(sheet, icons, name, output_path):
+    """
+    Generate a C header file with the sprite sheet and the icon ids
+    """
+    header_name = os.path.basename(output_path).upper().replace('.', '_').replace('-', '_')
+    prefix = name.upper()
+
+    with open(output_path, 'w') as f:
+        f.write(f"""/*
+
+  {os.path.basename(output_path)} icons for screen.
+  Icon sheet generated by icon_converter.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _{header_name}_
+#define _{header_name}_
+
+// Icon ids
+""")
+        for i, (icon, width, height, size) in enumerate(icons):
+            f.write(f"#define {prefix}_{icon} {i} // {width}x{height}\n")
+        f.write(f"#define {prefix}_COUNT {len(icons)}\n\n")
+
+        f.write(f"static const uint8_t {name}[] = {{\n")
+        f.write(f"\t0x{sheet[0]:02X}, // Icon count: {sheet[0]}\n")
+        f.write("\t// Index: offset MSB, offset LSB, width, pages\n")
+        for i, (icon, width, height, size) in enumerate(icons):
+            entry = sheet[1 + i * ICON_INDEX_ENTRY_SIZE:1 + (i + 1) * ICON_INDEX_ENTRY_SIZE]
+            f.write("\t" + ", ".join(f"0x{b:02X}" for b in entry) + f", // {icon}\n")
+        offset = 1 + len(icons) * ICON_INDEX_ENTRY_SIZE
+        for i, (icon, width, height, size) in enumerate(icons):
+            f.write(f"\t// {icon}\n")
+            icon_bytes = sheet[offset:offset + size]
+            for j in range(0, len(icon_bytes), width):
+                line = "\t" + ", ".join(f"0x{b:02X}" for b in icon_bytes[j:j + width])
+                last = (i == len(icons) - 1) and (j + width >= len(icon_bytes))
+                f.write(line + ("\n" if last else ",\n"))
+            offset += size
+        f.write("};\n")
+        f.write(f"#endif // _{header_name}_\n")
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack icons in a page-aligned sprite sheet header')
+    parser.add_argument('icons', nargs='+', help='Icon files (PNG or text template), the file name is the icon name')
+    parser.add_argument('--output', '-o', help='Output header file path (default: <name>.h)')
+    parser.add_argument('--name', default='icons', help='Variable name of the sheet, also prefix of the icon ids (default: icons)')
+
+    args = parser.parse_args()
+    output = args.output if args.output else f"{args.name}.h"
+
+    try:
+        sheet, icons = build_sheet(args.icons)
+    except (ValueError, OSError) as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    generate_c_header(sheet, icons, args.name, output)
+
+    print(f"Icon sheet complete! Output saved to {output}")
+    for i, (icon, width, height, size) in enumerate(icons):
+        print(f"  {i}: {args.name.upper()}_{icon} {width}x{height}, {size} bytes")
+    print(f"Total bytes: {len(sheet)}")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""
+Layout Generator for OLED Displays
+Creates the layout header of a display size: for each number of axes, the table of
+fields drawn by the plugin at each update.
+
+A layout is described by a Python function in the LAYOUTS table, returning the fields
+for a number of axes. Fields are drawn in order, a field is:
+   - text of a source: machine state, IP address, axis label or axis position
+   - status icons, drawn after a field and before another one if there is room left
+   - filled rectangle
+   - endstop box of an axis, filled when the endstop is triggered
+
+Positions:
+   - x is the left edge of left aligned fields, the right edge (excluded) of right aligned
+     fields, or the gap after the right edge of the field named by 'after'
+   - y is the top of the field, 'line' times the font height is added to it
+   - fields with 'endstop_only' are hidden when the endstop of their axis is not reporting
+
+Usage:
+  python layout_generator.py -o ../layouts/layout_128x64.h
+  python layout_generator.py --size 72x40 -o ../layouts/layout_72x40.h
+  python layout_generator.py --size 128x64 --preview 3
+
+Copyright (C) 2025 Luc LEBOSSE
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+"""
+
+import argparse
+import os
+
+MAX_AXES = 6
+
+TYPES = {
+    'state': 'LAYOUT_STATE',
+    'ip': 'LAYOUT_IP',
+    'label': 'LAYOUT_LABEL',
+    'position': 'LAYOUT_POSITION',
+    'icons': 'LAYOUT_ICONS',
+    'fill': 'LAYOUT_FILL',
+    'endstop': 'LAYOUT_ENDSTOP',
+}
+FONTS = {'small': 'DISPLAY_FONT_SMALL', 'medium': 'DISPLAY_FONT_MEDIUM', 'big': 'DISPLAY_FONT_BIG'}
+COLORS = {'white': 'DISPLAY_COLOR_WHITE', 'black': 'DISPLAY_COLOR_BLACK'}
+ALIGNS = {'left': 'LAYOUT_ALIGN_LEFT', 'right': 'LAYOUT_ALIGN_RIGHT', 'after': 'LAYOUT_ALIGN_AFTER'}
+
+def field(type, name=None, axis=0, x=0, y=0, line=0, font='small', color='white', align='left',
+          after=None, before=None, width=0, height=0, font_height=False, endstop_only=False):
+    """
+    Field of a layout, see the module description
+    For icons, width is the margin kept before the field named by 'before'
+    For boxes, height is added to the font height if font_height is set
+    """
+    return {
+        'type': type, 'name': name, 'axis': axis, 'x': x, 'y': y, 'line': line, 'font': font,
+        'color': color, 'align': 'after' if after else align, 'after': after, 'before': before,
+        'width': width, 'height': height, 'font_height': font_height, 'endstop_only': endstop_only,
+    }
+
+def top_row(width, ip=True):
+    """Machine state, IP address and status icons between them"""
+    fields = [field('state', 'state', x=1, y=1, font='big', color='black')]
+    if ip:
+        fields.append(field('ip', 'ip', x=width - 1, y=2, align='right'))
+    fields.append(field('icons', after='state', x=4, before='ip' if ip else None, width=2))
+    return fields
+
+def axis_rows(rows, columns, column_width):
+    """
+    Axes in columns of rows: label on the left, position right aligned, then endstop box
+    Texts are drawn over their background from 1 pixel above, rows are 9 pixels apart at least
+    """
+    fields = []
+    for i in range(len(rows) * columns):
+        column, row = divmod(i, len(rows))
+        x = column * column_width
+        fields.append(field('label', axis=i, x=x, y=rows[row]))
+        fields.append(field('position', axis=i, x=x + column_width - 10, y=rows[row], align='right'))
+        fields.append(field('endstop', axis=i, x=x + column_width - 8, y=rows[row],
+                            width=5, height=-1, font_height=True, endstop_only=True))
+    return fields
+
+def trim(fields, n_axis):
+    """Remove the fields of axes beyond n_axis"""
+    return [f for f in fields if f['type'] not in ('label', 'position', 'endstop') or f['axis'] < n_axis]
+
+def layout_128x64(n_axis):
+    """
+    1 to 4 axes: a row for each axis, rows are spread over the display
+    5 and 6 axes: 2 columns of positions, endstops in a bar at the bottom
+    """
+    fields = top_row(128)
+
+    if n_axis >= 5:
+        for i in range(n_axis):
+            column = i // 3
+            y = 16 + (i % 3) * 12
+            fields.append(field('label', axis=i, x=column * 66, y=y))
+            fields.append(field('position', axis=i, x=60 + column * 67, y=y, align='right'))
+        fields.append(field('fill', x=0, y=53, width=128, height=11))
+        for i in range(n_axis):
+            fields.append(field('label', f'endstop_label{i}', axis=i, x=1 + i * 20, y=54,
+                                color='black', endstop_only=True))
+            fields.append(field('endstop', axis=i, after=f'endstop_label{i}', x=1, y=54,
+                                color='black', width=5, height=8, endstop_only=True))
+    else:
+        spacing = {1: 15, 2: 10, 3: 6, 4: 3}[n_axis]
+        x_end_stop_status = 90 if n_axis == 4 else 110
+        for i in range(n_axis):
+            y = 14 + (i + 1) * spacing
+            fields.append(field('label', axis=i, x=15, y=y, line=i))
+            fields.append(field('position', axis=i, x=x_end_stop_status - 5, y=y, line=i, align='right'))
+            fields.append(field('endstop', axis=i, x=x_end_stop_status, y=y, line=i,
+                                width=5, height=-1, font_height=True, endstop_only=True))
+
+    return fields
+
+def layout_128x32(n_axis):
+    """
+    1 and 2 axes: a row for each axis
+    3 and 4 axes: 2 columns of 2 rows
+    5 axes: 2 columns of 3 rows, the state in the last one, no icons nor IP address
+    More axes do not fit
+    """
+    if n_axis <= 2:
+        fields = top_row(128)
+        for i, y in enumerate([18] if n_axis == 1 else [14, 24]):
+            fields.append(field('label', axis=i, x=15, y=y))
+            fields.append(field('position', axis=i, x=105, y=y, align='right'))
+            fields.append(field('endstop', axis=i, x=110, y=y, width=5, height=-1, font_height=True, endstop_only=True))
+        return fields
+    if n_axis <= 4:
+        return top_row(128) + trim(axis_rows([14, 24], 2, 65), n_axis)
+    if n_axis == 5:
+        return trim(axis_rows([5, 14, 23], 2, 65), n_axis) + [field('state', x=66, y=23)]
+    return None
+
+def layout_72x40(n_axis):
+    """
+    No IP address, it does not fit beside the state
+    1 to 3 axes: a row for each axis
+    More axes do not fit
+    """
+    if n_axis > 3:
+        return None
+    rows = {1: [23], 2: [17, 29], 3: [14, 23, 32]}[n_axis]
+    return top_row(72, ip=False) + axis_rows(rows, 1, 75)
+
+# Layout of each display size
+LAYOUTS = {
+    (128, 64): layout_128x64,
+    (128, 32): layout_128x32,
+    (72, 40): layout_72x40,
+}
+
+def resolve(fields):
+    """
+    Replace the field names of 'after' and 'before' by field indexes,
+    the named fields must come first as their position is used
+    """
+    names = {f['name']: i for i, f in enumerate(fields) if f['name']}
+    for i, f in enumerate(fields):
+        for key in ('after', 'before'):
+            if f[key] is not None:
+                if names.get(f[key], i) >= i:
+                    raise ValueError(f"field {i} refers to '{f[key]}', which must come first")
+                f[key] = names[f[key]]
+    return fields
+
+def format_field(f):
+    """C initializer of a field"""
+    flags = []
+    if f['endstop_only']:
+        flags.append('LAYOUT_ENDSTOP_ONLY')
+    if f['font_height']:
+        flags.append('LAYOUT_FONT_HEIGHT')
+    ref = lambda index: 'LAYOUT_NONE' if index is None else str(index)
+    values = [TYPES[f['type']], ' | '.join(flags) or '0', str(f['axis']), FONTS[f['font']],
+              COLORS[f['color']], ALIGNS[f['align']], ref(f['after']), ref(f['before']),
+              str(f['x']), str(f['y']), str(f['line']), str(f['width']), str(f['height'])]
+    return "{ " + ", ".join(values) + " }"
+
+def generate_c_header(width, height, layout, output_path):
+    """
+    Generate a C header file with the layout of each number of axes
+    """
+    header_name = os.path.basename(output_path).upper().replace('.', '_').replace('-', '_')
+
+    with open(output_path, 'w') as f:
+        f.write(f"""/*
+
+  {os.path.basename(output_path)} layout of a {width} x {height} display.
+  Layout file generated by layout_generator.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _{header_name}_
+#define _{header_name}_
+
+/**
+ * Fields of a {width} x {height} display, drawn in order
+ * type, flags, axis, font, color, align, after, before, x, y, line, width, height
+ */
+""")
+        for n_axis in range(1, MAX_AXES + 1):
+            fields = layout(n_axis)
+            if n_axis == 1:
+                f.write(f"#if N_AXIS == {n_axis}\n")
+            elif n_axis < MAX_AXES:
+                f.write(f"#elif N_AXIS == {n_axis}\n")
+            else:
+                f.write(f"#else // N_AXIS >= {n_axis}\n")
+            if fields is None:
+                f.write(f"#error \"No {width} x {height} layout for {n_axis} axes\"\n")
+                continue
+            fields = resolve(fields)
+            f.write("static const layout_field_t layout_fields[] = {\n")
+            for i, field_data in enumerate(fields):
+                last = i == len(fields) - 1
+                f.write("\t" + format_field(field_data) + ("" if last else ",") + f" // {i}\n")
+            f.write("};\n")
+        f.write("#endif // N_AXIS\n\n")
+        f.write(f"#endif // _{header_name}_\n")
+
+def preview(layout, n_axis):
+    """Print the fields of a layout"""
+    fields = layout(n_axis)
+    if fields is None:
+        print(f"No layout for {n_axis} axes")
+        return
+    for i, f in enumerate(resolve(fields)):
+        axis = f" axis {f['axis']}" if f['type'] in ('label', 'position', 'endstop') else ''
+        print(f"{i:2}: {f['type']}{axis} {f['align']} x {f['x']} y {f['y']} + {f['line']} lines"
+              f"{' (endstop only)' if f['endstop_only'] else ''}")
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the layout header of a display size')
+    parser.add_argument('--output', '-o', help='Output header file path (default: layout_WxH.h)')
+    parser.add_argument('--size', default='128x64', help='Display size, one of: ' +
+                        ', '.join(f'{w}x{h}' for w, h in LAYOUTS) + ' (default: 128x64)')
+    parser.add_argument('--preview', type=int, metavar='N_AXIS', help='Print the fields for N_AXIS axes instead')
+
+    args = parser.parse_args()
+
+    width, height = (int(v) for v in args.size.lower().split('x'))
+    if (width, height) not in LAYOUTS:
+        parser.error(f"no layout for {args.size}")
+    layout = LAYOUTS[(width, height)]
+
+    if args.preview:
+        preview(layout, args.preview)
+        return
+
+    output = args.output or f'layout_{width}x{height}.h'
+    generate_c_header(width, height, layout, output)
+
+    print(f"Layout complete! Output saved to {output}")
+    counts = ((n_axis, layout(n_axis)) for n_axis in range(1, MAX_AXES + 1))
+    print("Fields: " + ", ".join(f"{len(fields)} for {n_axis} axes" for n_axis, fields in counts if fields))
+
+if __name__ == "__main__":
+    main()
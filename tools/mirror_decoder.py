@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+Display Mirror Decoder for OLED Displays
+Rebuilds the display frames from the records written by the plugin after $OLEDMIRROR,
+and the screenshots written after $OLEDSHOT.
+
+Records (other lines of the stream are ignored):
+   [OLED:KEY,width,height]            key frame start, the whole display follows
+   [OLED:page,column,length,base64]   span of a page: length bytes, one per column, bit 0 on top
+   [OLED:END]                         end of refresh, the frame is complete
+   [OLEDSHOT:BEGIN,width,height,size] screenshot start, size is the PBM file size
+   [OLEDSHOT:base64]                  run length encoded PBM bytes
+   [OLEDSHOT:END,size]                screenshot end, size is the compressed size
+
+Usage:
+  python mirror_decoder.py capture.log
+  python mirror_decoder.py capture.log --output frames
+  python mirror_decoder.py --port /dev/ttyUSB0
+  python mirror_decoder.py --port /dev/ttyUSB0 --screenshot
+
+Copyright (C) 2025 Luc LEBOSSE
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+"""
+
+import argparse
+import base64
+import os
+import sys
+
+RECORD_PREFIX = '[OLED:'
+SCREENSHOT_PREFIX = '[OLEDSHOT:'
+
+def rle_decode(data):
+    """
+    Decode run length encoded bytes (same encoding as png_converter.py --rle):
+    [0x80 | (count - 1)][byte] runs and [count - 1][bytes] literals
+    """
+    decoded = bytearray()
+    i = 0
+    while i < len(data):
+        control = data[i]
+        count = (control & 0x7F) + 1
+        if control & 0x80:
+            decoded += bytes([data[i + 1]]) * count
+            i += 2
+        else:
+            decoded += data[i + 1:i + 1 + count]
+            i += 1 + count
+    return bytes(decoded)
+
+class ScreenshotDecoder:
+    """
+    Collect screenshot records
+    """
+    def __init__(self):
+        self.size = 0
+        self.data = None
+        self.count = 0
+
+    def feed(self, line):
+        """
+        Apply a stream line
+        Returns the PBM file when a screenshot is complete, None otherwise
+        """
+        line = line.strip()
+        if not line.startswith(SCREENSHOT_PREFIX) or not line.endswith(']'):
+            return None
+        fields = line[len(SCREENSHOT_PREFIX):-1].split(',')
+
+        if fields[0] == 'BEGIN':
+            self.size = int(fields[3])
+            self.data = bytearray()
+            return None
+        if self.data is None:
+            return None
+        if fields[0] == 'END':
+            if len(self.data) != int(fields[1]):
+                raise ValueError(f"screenshot has {len(self.data)} bytes instead of {fields[1]}")
+            pbm = rle_decode(self.data)
+            if len(pbm) != self.size:
+                raise ValueError(f"screenshot PBM has {len(pbm)} bytes instead of {self.size}")
+            self.data = None
+            self.count += 1
+            return pbm
+        self.data += base64.b64decode(fields[0])
+        return None
+
+class MirrorDecoder:
+    """
+    Apply mirror records to a copy of the display memory
+    """
+    def __init__(self):
+        self.width = 0
+        self.height = 0
+        self.pages = 0
+        self.buffer = None
+        self.frames = 0
+        self.record_bytes = 0
+
+    def feed(self, line):
+        """
+        Apply a stream line
+        Returns True when a frame is complete
+        """
+        line = line.strip()
+        if not line.startswith(RECORD_PREFIX) or not line.endswith(']'):
+            return False
+        self.record_bytes += len(line) + 2
+        fields = line[len(RECORD_PREFIX):-1].split(',')
+
+        if fields[0] == 'KEY':
+            self.width = int(fields[1])
+            self.height = int(fields[2])
+            self.pages = (self.height + 7) // 8
+            self.buffer = bytearray(self.width * self.pages)
+            return False
+        if fields[0] == 'END':
+            if self.buffer is None:
+                return False
+            self.frames += 1
+            return True
+        if self.buffer is None:
+            # Spans before the first key frame cannot be placed
+            return False
+
+        page, column, length = int(fields[0]), int(fields[1]), int(fields[2])
+        data = base64.b64decode(fields[3])
+        if len(data) != length or page >= self.pages or column + length > self.width:
+            raise ValueError(f"invalid span record: {line}")
+        offset = page * self.width + column
+        self.buffer[offset:offset + length] = data
+        return False
+
+    def pixel(self, x, y):
+        return (self.buffer[(y // 8) * self.width + x] >> (y % 8)) & 1
+
+    def to_text(self):
+        """Frame as text, '#' for a lit pixel"""
+        return '\n'.join(''.join('#' if self.pixel(x, y) else '.' for x in range(self.width))
+                         for y in range(self.height))
+
+    def to_pbm(self):
+        """Frame as a plain PBM image (1 is black, so lit pixels are written as 0)"""
+        rows = [' '.join('0' if self.pixel(x, y) else '1' for x in range(self.width)) for y in range(self.height)]
+        return f"P1\n{self.width} {self.height}\n" + '\n'.join(rows) + '\n'
+
+def read_lines(args):
+    """Lines of the capture file, stdin or serial port"""
+    if args.port:
+        import serial
+        with serial.Serial(args.port, args.baudrate, timeout=1) as port:
+            port.write(b"$OLEDSHOT\n" if args.screenshot else b"$OLEDMIRROR\n")
+            while True:
+                yield port.readline().decode('ascii', errors='ignore')
+    elif args.input and args.input != '-':
+        with open(args.input, 'r', errors='ignore') as f:
+            yield from f
+    else:
+        yield from sys.stdin
+
+def main():
+    parser = argparse.ArgumentParser(description='Rebuild the display frames mirrored by the OLED display plugin')
+    parser.add_argument('input', nargs='?', help='Stream capture file (default: stdin)')
+    parser.add_argument('--port', help='Serial port of the controller, $OLEDMIRROR is sent to subscribe')
+    parser.add_argument('--screenshot', action='store_true', help='Send $OLEDSHOT instead of $OLEDMIRROR to the serial port')
+    parser.add_argument('--baudrate', type=int, default=115200, help='Serial port baudrate (default: 115200)')
+    parser.add_argument('--output', '-o', help='Directory to write each frame as frame_NNNN.pbm and screenshots as screenshot_NNNN.pbm')
+    parser.add_argument('--quiet', '-q', action='store_true', help='Do not print the frames')
+
+    args = parser.parse_args()
+    if args.output:
+        os.makedirs(args.output, exist_ok=True)
+
+    decoder = MirrorDecoder()
+    screenshots = ScreenshotDecoder()
+    previous_bytes = 0
+    try:
+        for line in read_lines(args):
+            pbm = screenshots.feed(line)
+            if pbm is not None:
+                path = os.path.join(args.output or '.', f"screenshot_{screenshots.count:04d}.pbm")
+                with open(path, 'wb') as f:
+                    f.write(pbm)
+                print(f"Screenshot saved to {path}")
+                if args.port and args.screenshot:
+                    break
+                continue
+            if not decoder.feed(line):
+                continue
+            if not args.quiet:
+                print(decoder.to_text())
+            print(f"Frame {decoder.frames}: {decoder.record_bytes - previous_bytes} bytes of records")
+            previous_bytes = decoder.record_bytes
+            if args.output:
+                with open(os.path.join(args.output, f"frame_{decoder.frames:04d}.pbm"), 'w') as f:
+                    f.write(decoder.to_pbm())
+    except KeyboardInterrupt:
+        pass
+    except ValueError as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    print(f"Frames: {decoder.frames}, record bytes: {decoder.record_bytes}")
+
+if __name__ == "__main__":
+    main()
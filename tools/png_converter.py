@@ -1,7 +1,27 @@
 #!/usr/bin/env python3
 """
 PNG Converter for OLED Displays
-Converts PNG file to a C header file format compatible with OLED display libraries.
+Converts PNG file to a C header file format compatible with OLED display libraries,
+or to a page-major binary image file loadable at runtime from the controller file system.
+
+Image file format (--binary):
+   - Byte 0: width
+   - Byte 1: height
+   - Byte 2: flags (0x01: RLE)
+   - Then for each page of 8 rows, width bytes, bit 0 is the top row of the page
+     (the display memory layout, so the file can be streamed to the display buffer)
+   - RLE data is a sequence of blocks:
+     [0x80 | (count - 1)][byte]: byte repeated count times
+     [count - 1][count bytes]: count bytes copied as is
+
+Animation format (--animation, C header):
+   - Byte 0: width
+   - Byte 1: height
+   - Byte 2: frame count (key frame included)
+   - Byte 3: delay between frames in 10 ms units
+   - Key frame in page-major layout (width bytes per page)
+   - Then for each next frame: [span count] and for each span the bytes that
+     changed from the previous frame: [page][column][length][length bytes]
 
 Copyright (C) 2025 Luc LEBOSSE
 
@@ -20,6 +40,7 @@ License along with this library; if not, write to the Free Software
 Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 """
 
+import argparse
 import sys
 import os
 from PIL import Image
@@ -117,13 +138,209 @@ static const char logo_bits[] = {{
     print(f"XBM variable name: logo_bits")
     print(f"Total bytes: {len(bytes)}")
 
-if __name__ == "__main__":
-    if len(sys.argv) < 3:
-        print("Usage: python png_converter.py input.png output.xbm [variable_name]")
+IMAGE_FLAG_RLE = 0x01
+
+def rle_encode(data):
+    """
+    Run length encode bytes: runs of 3 or more identical bytes become
+    [0x80 | (count - 1)][byte], other bytes are grouped in [count - 1][bytes] literals
+    """
+    encoded = []
+    i = 0
+    while i < len(data):
+        # Measure run at current position
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 128:
+            run += 1
+        if run >= 3:
+            encoded += [0x80 | (run - 1), data[i]]
+            i += run
+            continue
+        # Literal until next run of 3 identical bytes
+        literal = []
+        while i < len(data) and len(literal) < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            literal.append(data[i])
+            i += 1
+        encoded += [len(literal) - 1] + literal
+    return encoded
+
+def image_to_pages(img):
+    """
+    Convert a 1-bit image to page-major bytes: for each page of 8 rows, one byte per column,
+    bit 0 at the top. Black pixels are set, like in XBM files.
+    """
+    width, height = img.size
+    pages = (height + 7) // 8
+    data = []
+    for page in range(pages):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and not img.getpixel((x, y)):
+                    byte |= (1 << bit)
+            data.append(byte)
+    return data
+
+def png_to_binary(png_file, bin_file, rle=False):
+    # Open the PNG file and convert to 1-bit (black and white)
+    img = Image.open(png_file).convert('1')
+    width, height = img.size
+    if width > 255 or height > 255:
+        print("Error: image is limited to 255x255 pixels")
         sys.exit(1)
-    
-    png_file = sys.argv[1]
-    xbm_file = sys.argv[2]
-    var_name = sys.argv[3] if len(sys.argv) > 3 else None
-    
-    png_to_xbm(png_file, xbm_file, var_name)
+
+    data = image_to_pages(img)
+    flags = 0
+    if rle:
+        encoded = rle_encode(data)
+        if len(encoded) < len(data):
+            data = encoded
+            flags |= IMAGE_FLAG_RLE
+        else:
+            print("RLE does not reduce size, image is stored raw")
+
+    with open(bin_file, 'wb') as f:
+        f.write(bytes([width, height, flags] + data))
+
+    print(f"Converted {png_file} to {bin_file}")
+    print(f"Image size: {width}x{height} pixels")
+    print(f"Total bytes: {3 + len(data)}{' (RLE)' if flags & IMAGE_FLAG_RLE else ''}")
+
+# Spans closer than this are merged, a new span costs its 3 bytes header
+SPAN_MERGE_GAP = 3
+
+def frame_delta(previous, current, width, pages):
+    """
+    Get the spans of bytes that changed between two page-major frames
+    Returns a list of (page, column, bytes)
+    """
+    spans = []
+    for page in range(pages):
+        row_previous = previous[page * width:(page + 1) * width]
+        row_current = current[page * width:(page + 1) * width]
+        column = 0
+        while column < width:
+            if row_previous[column] == row_current[column]:
+                column += 1
+                continue
+            # Extend the span while next change is close enough
+            start = column
+            end = column
+            while True:
+                next_change = end + 1
+                while next_change < width and row_previous[next_change] == row_current[next_change]:
+                    next_change += 1
+                if next_change >= width or next_change - end - 1 > SPAN_MERGE_GAP or next_change - start >= 255:
+                    break
+                end = next_change
+            spans.append((page, start, row_current[start:end + 1]))
+            column = end + 1
+    return spans
+
+def png_sequence_to_animation(png_files, header_file, var_name=None, delay=100, loop=False):
+    frames = [Image.open(png_file).convert('1') for png_file in png_files]
+    width, height = frames[0].size
+    for png_file, frame in zip(png_files, frames):
+        if frame.size != (width, height):
+            print(f"Error: {png_file} size differs from first frame size {width}x{height}")
+            sys.exit(1)
+    if width > 255 or height > 255:
+        print("Error: animation is limited to 255x255 pixels")
+        sys.exit(1)
+
+    pages = (height + 7) // 8
+    frames_data = [image_to_pages(frame) for frame in frames]
+    # Going back to the key frame allows to repeat the animation
+    if loop:
+        frames_data.append(frames_data[0])
+    if len(frames_data) > 255:
+        print("Error: animation is limited to 255 frames")
+        sys.exit(1)
+
+    frame_delay = max(1, min(255, round(delay / 10)))
+    key_size = len(frames_data[0])
+    data = [width, height, len(frames_data), frame_delay] + frames_data[0]
+    for i in range(1, len(frames_data)):
+        spans = frame_delta(frames_data[i - 1], frames_data[i], width, pages)
+        if len(spans) > 255:
+            print(f"Error: frame {i} has too many changes")
+            sys.exit(1)
+        data.append(len(spans))
+        for page, column, span_bytes in spans:
+            data += [page, column, len(span_bytes)] + span_bytes
+    delta_size = len(data) - 4 - key_size
+
+    if var_name is None:
+        var_name = os.path.basename(header_file).split('.')[0].replace('-', '_')
+
+    # Create header guard based on the output filename
+    header_name = os.path.basename(header_file).upper().replace('.', '_').replace('-', '_')
+
+    header = f"""/*
+
+  {os.path.basename(header_file)} animation for screen.
+  Animation file generated by png_converter.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _{header_name}_
+#define _{header_name}_
+// {width}x{height} pixels, {len(frames_data)} frames, {frame_delay * 10} ms per frame{', ends on key frame' if loop else ''}
+// Key frame: {key_size} bytes, deltas: {delta_size} bytes
+static const uint8_t {var_name}[] = {{
+"""
+    for i in range(0, len(data), 12):
+        chunk = data[i:i+12]
+        line = "  " + ", ".join(f"0x{byte:02x}" for byte in chunk)
+        if i + 12 < len(data):
+            line += ","
+        header += line + "\n"
+    header += "};\n"
+    header += f"#endif // _{header_name}_\n"
+
+    with open(header_file, 'w') as f:
+        f.write(header)
+
+    print(f"Converted {len(png_files)} frames to {header_file}")
+    print(f"Animation size: {width}x{height} pixels")
+    print(f"Total bytes: {len(data)} (key frame {key_size}, deltas {delta_size}, full frames would be {len(frames_data) * key_size})")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Convert PNG file to XBM header or page-major binary image file')
+    parser.add_argument('input', help='Input PNG file')
+    parser.add_argument('output', help='Output header or binary file path')
+    parser.add_argument('var_name', nargs='?', help='Variable name in the header')
+    parser.add_argument('--binary', action='store_true', help='Write a page-major binary image file to load from the controller file system')
+    parser.add_argument('--rle', action='store_true', help='Run length encode the binary image file')
+    parser.add_argument('--animation', nargs='+', metavar='PNG', help='Next frames of an animation, input is the key frame')
+    parser.add_argument('--delay', type=int, default=100, help='Delay between animation frames in ms (default: 100)')
+    parser.add_argument('--loop', action='store_true', help='End the animation on its key frame so it can be repeated')
+
+    args = parser.parse_args()
+
+    if args.animation:
+        png_sequence_to_animation([args.input] + args.animation, args.output, args.var_name, args.delay, args.loop)
+    elif args.binary:
+        png_to_binary(args.input, args.output, args.rle)
+    else:
+        png_to_xbm(args.input, args.output, args.var_name)
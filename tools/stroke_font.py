@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+Stroke Font Generator for OLED Displays
+Creates a compact vector (Hershey-style) font header, drawn with lines at any integer height.
+
+Glyphs are polylines on a grid 4 units wide and 8 units high (y = 0 is the top, 8 the baseline).
+Only digits, capital letters and the DRO punctuation are defined.
+
+Font format:
+   - Byte 0: grid height (units scaled to the requested pixel height)
+   - Byte 1: number of characters N
+   - N bytes: character codes
+   - N jump table entries of 3 bytes: [offset MSB][offset LSB][width in grid units]
+     offset is relative to the start of the stroke data
+   - Stroke data: for each glyph, points as (x << 4) | y,
+     0xFF lifts the pen (next point starts a new polyline), 0xFE ends the glyph
+
+Usage:
+  python stroke_font.py -o ../fonts/stroke.h
+
+Copyright (C) 2025 Luc LEBOSSE
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 3 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+"""
+
+import argparse
+import os
+
+GRID_HEIGHT = 8
+PEN_UP = 0xFF
+GLYPH_END = 0xFE
+
+# Polylines of each glyph, a glyph is a list of polylines, a polyline a list of (x, y)
+O_SHAPE = [(1, 0), (3, 0), (4, 1), (4, 7), (3, 8), (1, 8), (0, 7), (0, 1), (1, 0)]
+P_SHAPE = [(0, 8), (0, 0), (3, 0), (4, 1), (4, 3), (3, 4), (0, 4)]
+
+GLYPHS = {
+    ' ': [],
+    '+': [[(2, 2), (2, 6)], [(0, 4), (4, 4)]],
+    '-': [[(1, 4), (3, 4)]],
+    '.': [[(1, 7), (1, 8)]],
+    '/': [[(0, 8), (4, 0)]],
+    ':': [[(1, 2), (1, 3)], [(1, 6), (1, 7)]],
+    '0': [O_SHAPE, [(4, 1), (0, 7)]],
+    '1': [[(1, 1), (2, 0), (2, 8)], [(1, 8), (3, 8)]],
+    '2': [[(0, 1), (1, 0), (3, 0), (4, 1), (4, 3), (0, 8), (4, 8)]],
+    '3': [[(0, 1), (1, 0), (3, 0), (4, 1), (4, 3), (3, 4), (1, 4)],
+          [(3, 4), (4, 5), (4, 7), (3, 8), (1, 8), (0, 7)]],
+    '4': [[(3, 8), (3, 0), (0, 6), (4, 6)]],
+    '5': [[(4, 0), (0, 0), (0, 4), (3, 4), (4, 5), (4, 7), (3, 8), (0, 8)]],
+    '6': [[(3, 0), (1, 0), (0, 1), (0, 7), (1, 8), (3, 8), (4, 7), (4, 5), (3, 4), (0, 4)]],
+    '7': [[(0, 0), (4, 0), (1, 8)]],
+    '8': [[(1, 0), (3, 0), (4, 1), (4, 3), (3, 4), (1, 4), (0, 3), (0, 1), (1, 0)],
+          [(1, 4), (0, 5), (0, 7), (1, 8), (3, 8), (4, 7), (4, 5), (3, 4)]],
+    '9': [[(4, 4), (1, 4), (0, 3), (0, 1), (1, 0), (3, 0), (4, 1), (4, 7), (3, 8), (1, 8)]],
+    'A': [[(0, 8), (0, 2), (2, 0), (4, 2), (4, 8)], [(0, 5), (4, 5)]],
+    'B': [[(0, 8), (0, 0), (3, 0), (4, 1), (4, 3), (3, 4), (0, 4)],
+          [(3, 4), (4, 5), (4, 7), (3, 8), (0, 8)]],
+    'C': [[(4, 1), (3, 0), (1, 0), (0, 1), (0, 7), (1, 8), (3, 8), (4, 7)]],
+    'D': [[(0, 0), (3, 0), (4, 1), (4, 7), (3, 8), (0, 8), (0, 0)]],
+    'E': [[(4, 0), (0, 0), (0, 8), (4, 8)], [(0, 4), (3, 4)]],
+    'F': [[(4, 0), (0, 0), (0, 8)], [(0, 4), (3, 4)]],
+    'G': [[(4, 1), (3, 0), (1, 0), (0, 1), (0, 7), (1, 8), (3, 8), (4, 7), (4, 4), (2, 4)]],
+    'H': [[(0, 0), (0, 8)], [(4, 0), (4, 8)], [(0, 4), (4, 4)]],
+    'I': [[(1, 0), (3, 0)], [(2, 0), (2, 8)], [(1, 8), (3, 8)]],
+    'J': [[(4, 0), (4, 7), (3, 8), (1, 8), (0, 7)]],
+    'K': [[(0, 0), (0, 8)], [(4, 0), (0, 5)], [(1, 4), (4, 8)]],
+    'L': [[(0, 0), (0, 8), (4, 8)]],
+    'M': [[(0, 8), (0, 0), (2, 4), (4, 0), (4, 8)]],
+    'N': [[(0, 8), (0, 0), (4, 8), (4, 0)]],
+    'O': [O_SHAPE],
+    'P': [P_SHAPE],
+    'Q': [O_SHAPE, [(2, 6), (4, 8)]],
+    'R': [P_SHAPE, [(2, 4), (4, 8)]],
+    'S': [[(4, 1), (3, 0), (1, 0), (0, 1), (0, 3), (1, 4), (3, 4), (4, 5), (4, 7), (3, 8), (1, 8), (0, 7)]],
+    'T': [[(0, 0), (4, 0)], [(2, 0), (2, 8)]],
+    'U': [[(0, 0), (0, 7), (1, 8), (3, 8), (4, 7), (4, 0)]],
+    'V': [[(0, 0), (2, 8), (4, 0)]],
+    'W': [[(0, 0), (1, 8), (2, 4), (3, 8), (4, 0)]],
+    'X': [[(0, 0), (4, 8)], [(4, 0), (0, 8)]],
+    'Y': [[(0, 0), (2, 4), (4, 0)], [(2, 4), (2, 8)]],
+    'Z': [[(0, 0), (4, 0), (0, 8), (4, 8)]],
+}
+
+# Width of glyphs without strokes
+SPACE_WIDTH = 3
+
+def encode_font(glyphs):
+    """
+    Encode the glyphs in the stroke font format
+    Returns (font data, list of (char, offset, width, size))
+    """
+    codes = sorted(glyphs.keys(), key=ord)
+    table = []
+    strokes = []
+    entries = []
+    for char in codes:
+        polylines = glyphs[char]
+        offset = len(strokes)
+        width = max((x for polyline in polylines for x, y in polyline), default=SPACE_WIDTH - 1) + 1
+        for i, polyline in enumerate(polylines):
+            if i > 0:
+                strokes.append(PEN_UP)
+            for x, y in polyline:
+                if not (0 <= x < 15 and 0 <= y <= GRID_HEIGHT):
+                    raise ValueError(f"point {(x, y)} of '{char}' is out of the grid")
+                strokes.append((x << 4) | y)
+        strokes.append(GLYPH_END)
+        table += [(offset >> 8) & 0xFF, offset & 0xFF, width]
+        entries.append((char, offset, width, len(strokes) - offset))
+
+    data = [GRID_HEIGHT, len(codes)] + [ord(c) for c in codes] + table + strokes
+    return data, entries
+
+def generate_c_header(font_data, entries, name, output_path):
+    """
+    Generate a C header file with the stroke font
+    """
+    header_name = os.path.basename(output_path).upper().replace('.', '_').replace('-', '_')
+    count = font_data[1]
+    table_offset = 2 + count
+    data_offset = table_offset + count * 3
+
+    with open(output_path, 'w') as f:
+        f.write(f"""/*
+
+  {os.path.basename(output_path)} stroke font for screen.
+  Font file generated by stroke_font.py
+
+  Part of grblHAL
+
+  Copyright (c) 2025 Luc LEBOSSE
+
+  grblHAL is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  grblHAL is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more programmed.
+
+  You should have received a copy of the GNU General Public License
+  along with grblHAL. If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _{header_name}_
+#define _{header_name}_
+
+/**
+ * Stroke font, {count} characters, {len(font_data)} bytes
+ * Points are (x << 4) | y on a grid {GRID_HEIGHT} units high, 0xFF lifts the pen, 0xFE ends the glyph
+ */
+static const uint8_t {name}[] = {{
+\t0x{font_data[0]:02X}, // Grid height: {font_data[0]}
+\t0x{font_data[1]:02X}, // Number of chars: {count}
+\t// Character codes
+""")
+        codes = font_data[2:table_offset]
+        for i in range(0, len(codes), 16):
+            f.write("\t" + ", ".join(f"0x{c:02X}" for c in codes[i:i + 16]) + ",\n")
+        f.write("\t// Jump table: offset MSB, offset LSB, width\n")
+        for i, (char, offset, width, size) in enumerate(entries):
+            entry = font_data[table_offset + i * 3:table_offset + (i + 1) * 3]
+            f.write("\t" + ", ".join(f"0x{b:02X}" for b in entry) + f", // '{char}'\n")
+        f.write("\t// Strokes\n")
+        for i, (char, offset, width, size) in enumerate(entries):
+            glyph = font_data[data_offset + offset:data_offset + offset + size]
+            last = i == len(entries) - 1
+            f.write("\t" + ", ".join(f"0x{b:02X}" for b in glyph) + ("" if last else ",") + f" // '{char}'\n")
+        f.write("};\n")
+        f.write(f"#endif // _{header_name}_\n")
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the stroke font header')
+    parser.add_argument('--output', '-o', default='stroke.h', help='Output header file path (default: stroke.h)')
+    parser.add_argument('--name', default='stroke_font', help='Variable name of the font (default: stroke_font)')
+
+    args = parser.parse_args()
+
+    font_data, entries = encode_font(GLYPHS)
+    generate_c_header(font_data, entries, args.name, args.output)
+
+    print(f"Stroke font complete! Output saved to {args.output}")
+    print(f"Characters: {len(entries)}, data size: {len(font_data)} bytes")
+
+if __name__ == "__main__":
+    main()